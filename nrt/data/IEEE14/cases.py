@@ -140,6 +140,12 @@ job_file = os.path.join(os.path.dirname(__file__), "SA_divergence_failing_criter
 
 test_cases.append((case_name, case_description, "SA", job_file, -1, 5, True, standardReturnCodeType, standardReturnCode))
 
+case_name = "IEEE14_SA_steady_state"
+case_description = "IEEE14 - test of Systematic Analysis resumed window after window by a steady state detection never reached"
+job_file = os.path.join(os.path.dirname(__file__), "SA_steady_state", "IEEE14_SA_steady_state.zip")
+
+test_cases.append((case_name, case_description, "SA", job_file, -1, 5, True, standardReturnCodeType, standardReturnCode))
+
 #########################################
 #        IEEE14 - Simulation            #
 #########################################
@@ -158,4 +164,10 @@ test_cases.append((case_name, case_description, "CS", job_file, -1, 5, False, st
 # case_description = "IEEE14 - test of Critical Time Calculation with 3 scenarios"
 # job_file = os.path.join(os.path.dirname(__file__), "CTC", "IEEE14_CTC.zip")
 
+# test_cases.append((case_name, case_description, "CTC", job_file, -1, 10, True, standardReturnCodeType, standardReturnCode))
+
+# case_name = "IEEE14_CTC_instability"
+# case_description = "IEEE14 - test of Critical Time Calculation resumed window after window by an instability detection never triggered"
+# job_file = os.path.join(os.path.dirname(__file__), "CTC_instability", "IEEE14_CTC_instability.zip")
+
 # test_cases.append((case_name, case_description, "CTC", job_file, -1, 10, True, standardReturnCodeType, standardReturnCode))
\ No newline at end of file
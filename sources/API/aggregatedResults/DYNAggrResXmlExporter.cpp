@@ -67,6 +67,11 @@ XmlExporter::exportScenarioResultsToStream(const vector<SimulationResult>& resul
   formatter->endDocument();
 }
 
+void
+XmlExporter::exportScenarioResultToStream(const SimulationResult& result, ostream& stream) const {
+  FormatterPtr formatter = Formatter::createFormatter(stream, "http://www.rte-france.com/dynawo");
+  appendScenarioResultElement(result, formatter);
+}
 
 void
 XmlExporter::exportLoadIncreaseResultsToFile(const vector<LoadIncreaseResult>& results, const string& filePath) const {
@@ -90,10 +95,17 @@ XmlExporter::exportLoadIncreaseResultsToStream(const vector<LoadIncreaseResult>&
 
   for (auto loadIncreaseResultIt = results.cbegin(); loadIncreaseResultIt != results.cend(); ++loadIncreaseResultIt) {
     attrs.clear();
+    if (!loadIncreaseResultIt->getLoadIncreaseId().empty())
+      attrs.add("loadIncreaseId", loadIncreaseResultIt->getLoadIncreaseId());
     attrs.add("loadLevel", loadIncreaseResultIt->getResult().getVariation());
-    attrs.add("status", getStatusAsString(loadIncreaseResultIt->getResult().getStatus()));
+    if (loadIncreaseResultIt->isDecided())
+      attrs.add("decided", "true");
+    else
+      attrs.add("status", getStatusAsString(loadIncreaseResultIt->getResult().getStatus()));
+    if (loadIncreaseResultIt->isScreening())
+      attrs.add("screening", "true");
     formatter->startElement("loadIncreaseResults", attrs);
-    if (loadIncreaseResultIt->getResult().getStatus() == DYNAlgorithms::CONVERGENCE_STATUS) {
+    if (loadIncreaseResultIt->isDecided() || loadIncreaseResultIt->getResult().getStatus() == DYNAlgorithms::CONVERGENCE_STATUS) {
       appendScenarioResultsElement(loadIncreaseResultIt->getScenariosResults(), formatter);
     } else if (loadIncreaseResultIt->getResult().getStatus() == DYNAlgorithms::CRITERIA_NON_RESPECTED_STATUS) {
       appendCriteriaNonRespected(loadIncreaseResultIt->getResult(), formatter);
@@ -130,6 +142,10 @@ XmlExporter::exportCriticalTimeResultsToStream(const vector<CriticalTimeResult>&
     if (results[i].getStatus() == DYNAlgorithms::RESULT_FOUND_STATUS) {
       attrs.add("criticalTime", results[i].getCriticicalTime());
     }
+    if (results[i].getInstabilityTime() >= 0.) {
+      attrs.add("instabilityTime", results[i].getInstabilityTime());
+      attrs.add("instabilityReason", results[i].getInstabilityReason());
+    }
     formatter->startElement("scenarioResults", attrs);
     formatter->endElement();  // scenarioResults
   }
@@ -140,16 +156,22 @@ XmlExporter::exportCriticalTimeResultsToStream(const vector<CriticalTimeResult>&
 
 void
 XmlExporter::appendScenarioResultsElement(const vector<SimulationResult>& results, FormatterPtr& formatter) const {
+  for (size_t i=0; i < results.size(); i++)
+    appendScenarioResultElement(results[i], formatter);
+}
+
+void
+XmlExporter::appendScenarioResultElement(const SimulationResult& result, FormatterPtr& formatter) const {
   AttributeList attrs;
-  for (size_t i=0; i < results.size(); i++) {
-    attrs.clear();
-    const DYNAlgorithms::SimulationResult& result = results[i];
-    attrs.add("id", result.getScenarioId());
-    attrs.add("status", getStatusAsString(result.getStatus()));
-    formatter->startElement("scenarioResults", attrs);
-    appendCriteriaNonRespected(result, formatter);
-    formatter->endElement();  // scenarioResults
-  }
+  attrs.add("id", result.getScenarioId());
+  attrs.add("status", getStatusAsString(result.getStatus()));
+  if (result.isStoppedOnSteadyState())
+    attrs.add("steadyStateTime", result.getSteadyStateTime());
+  if (result.isScreening())
+    attrs.add("screening", "true");
+  formatter->startElement("scenarioResults", attrs);
+  appendCriteriaNonRespected(result, formatter);
+  formatter->endElement();  // scenarioResults
 }
 
 void
@@ -45,6 +45,18 @@ class XmlExporter {
    * @param stream stream where the simulation results must be exported
    */
   void exportScenarioResultsToStream(const std::vector<DYNAlgorithms::SimulationResult>& results, std::ostream& stream) const;
+
+  /**
+   * @brief Export the result of one scenario into a stream
+   *
+   * Only the scenarioResults element is written, without any document around it, so that the results can be appended
+   * one after the other to the same stream while they are computed
+   *
+   * @param result scenario result to export
+   * @param stream stream where the scenario result must be exported
+   */
+  void exportScenarioResultToStream(const DYNAlgorithms::SimulationResult& result, std::ostream& stream) const;
+
   /**
    * @brief Export load increase results into a file
    *
@@ -86,6 +98,14 @@ class XmlExporter {
    */
   void appendScenarioResultsElement(const std::vector<DYNAlgorithms::SimulationResult>& results, xml::sax::formatter::FormatterPtr& formatter) const;
 
+  /**
+   * @brief append to the formatter the results of one scenario
+   *
+   * @param result scenario result to export
+   * @param formatter formatter to extend
+   */
+  void appendScenarioResultElement(const DYNAlgorithms::SimulationResult& result, xml::sax::formatter::FormatterPtr& formatter) const;
+
   /**
    * @brief append to the formatter non-respected criteria
    *
@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNAggrResXmlHandler.cpp
+ *
+ * @brief handler for reading aggregated results file : implementation file
+ *
+ */
+
+#include "DYNAggrResXmlHandler.h"
+
+#include <xml/sax/parser/Attributes.h>
+
+#include <boost/phoenix/core.hpp>
+#include <boost/phoenix/operator/self.hpp>
+#include <boost/phoenix/bind.hpp>
+
+#include "DYNResultCommon.h"
+
+namespace lambda = boost::phoenix;
+namespace lambda_args = lambda::placeholders;
+namespace parser = xml::sax::parser;
+
+xml::sax::parser::namespace_uri aggregatedResults_ns("http://www.rte-france.com/dynawo");  ///< namespace used to read aggregated results xml file
+
+using DYNAlgorithms::SimulationResult;
+using DYNAlgorithms::LoadIncreaseResult;
+
+namespace aggregatedResults {
+
+XmlHandler::XmlHandler() :
+loadIncreaseResultsHandler_(parser::ElementName(aggregatedResults_ns, "loadIncreaseResults")) {
+  onElement(aggregatedResults_ns("aggregatedResults/loadIncreaseResults"), loadIncreaseResultsHandler_);
+
+  loadIncreaseResultsHandler_.onEnd(lambda::bind(&XmlHandler::addLoadIncreaseResult, lambda::ref(*this)));
+}
+
+const std::vector<LoadIncreaseResult>&
+XmlHandler::getLoadIncreaseResults() const {
+  return loadIncreaseResults_;
+}
+
+void
+XmlHandler::addLoadIncreaseResult() {
+  loadIncreaseResults_.push_back(*loadIncreaseResultsHandler_.get());
+}
+
+LoadIncreaseResultsHandler::LoadIncreaseResultsHandler(const elementName_type& root_element) :
+scenarioResultsHandler_(parser::ElementName(aggregatedResults_ns, "scenarioResults")) {
+  onStartElement(root_element, lambda::bind(&LoadIncreaseResultsHandler::create, lambda::ref(*this), lambda_args::arg2));
+
+  onElement(root_element + aggregatedResults_ns("scenarioResults"), scenarioResultsHandler_);
+
+  scenarioResultsHandler_.onEnd(lambda::bind(&LoadIncreaseResultsHandler::addScenarioResult, lambda::ref(*this)));
+}
+
+void
+LoadIncreaseResultsHandler::create(attributes_type const& attributes) {
+  loadIncreaseResult_ = boost::shared_ptr<LoadIncreaseResult>(new LoadIncreaseResult(0));
+  if (attributes.has("loadIncreaseId"))
+    loadIncreaseResult_->setLoadIncreaseId(attributes["loadIncreaseId"]);
+  if (attributes.has("screening"))
+    loadIncreaseResult_->setScreening(attributes["screening"]);
+  if (attributes.has("decided"))
+    loadIncreaseResult_->setDecided(attributes["decided"]);
+  SimulationResult& result = loadIncreaseResult_->getResult();
+  result.setVariation(attributes["loadLevel"]);
+  DYNAlgorithms::status_t status = DYNAlgorithms::EXECUTION_PROBLEM_STATUS;
+  if (attributes.has("status"))
+    getStatusFromString(attributes["status"].as_string(), status);
+  result.setStatus(status);
+  result.setSuccess(status == DYNAlgorithms::CONVERGENCE_STATUS);
+}
+
+void
+LoadIncreaseResultsHandler::addScenarioResult() {
+  SimulationResult scenarioResult = scenarioResultsHandler_.get();
+  scenarioResult.setVariation(loadIncreaseResult_->getResult().getVariation());
+  loadIncreaseResult_->addScenarioResult(scenarioResult);
+}
+
+boost::shared_ptr<LoadIncreaseResult>
+LoadIncreaseResultsHandler::get() const {
+  return loadIncreaseResult_;
+}
+
+ScenarioResultsHandler::ScenarioResultsHandler(const elementName_type& root_element) {
+  onStartElement(root_element, lambda::bind(&ScenarioResultsHandler::create, lambda::ref(*this), lambda_args::arg2));
+}
+
+void
+ScenarioResultsHandler::create(attributes_type const& attributes) {
+  scenarioResult_ = SimulationResult();
+  scenarioResult_.setScenarioId(attributes["id"]);
+  DYNAlgorithms::status_t status = DYNAlgorithms::EXECUTION_PROBLEM_STATUS;
+  getStatusFromString(attributes["status"].as_string(), status);
+  scenarioResult_.setStatus(status);
+  scenarioResult_.setSuccess(status == DYNAlgorithms::CONVERGENCE_STATUS);
+  if (attributes.has("steadyStateTime"))
+    scenarioResult_.setSteadyStateTime(attributes["steadyStateTime"]);
+  if (attributes.has("screening"))
+    scenarioResult_.setScreening(attributes["screening"]);
+}
+
+const SimulationResult&
+ScenarioResultsHandler::get() const {
+  return scenarioResult_;
+}
+
+}  // namespace aggregatedResults
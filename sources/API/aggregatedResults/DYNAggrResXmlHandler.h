@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNAggrResXmlHandler.h
+ *
+ * @brief handler for reading aggregated results file : header file
+ *
+ */
+#ifndef API_AGGREGATEDRESULTS_DYNAGGRRESXMLHANDLER_H_
+#define API_AGGREGATEDRESULTS_DYNAGGRRESXMLHANDLER_H_
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <xml/sax/parser/ComposableDocumentHandler.h>
+#include <xml/sax/parser/ComposableElementHandler.h>
+
+#include "DYNSimulationResult.h"
+#include "DYNLoadIncreaseResult.h"
+
+namespace aggregatedResults {
+
+/**
+ * @class ScenarioResultsHandler
+ * @brief Handler used to parse scenario results element
+ *
+ * Non-respected criteria are not read
+ */
+class ScenarioResultsHandler : public xml::sax::parser::ComposableElementHandler {
+ public:
+  /**
+   * @brief Constructor
+   * @param root_element complete name of the element read by the handler
+   */
+  explicit ScenarioResultsHandler(elementName_type const& root_element);
+
+  /**
+   * @brief return the scenario result read in xml file
+   * @return scenario result build thanks to infos read in xml file
+   */
+  const DYNAlgorithms::SimulationResult& get() const;
+
+ protected:
+  /**
+   * @brief Called when the XML element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void create(attributes_type const& attributes);
+
+ private:
+  DYNAlgorithms::SimulationResult scenarioResult_;  ///< current scenario result element
+};
+
+/**
+ * @class LoadIncreaseResultsHandler
+ * @brief Handler used to parse load increase results element
+ */
+class LoadIncreaseResultsHandler : public xml::sax::parser::ComposableElementHandler {
+ public:
+  /**
+   * @brief Constructor
+   * @param root_element complete name of the element read by the handler
+   */
+  explicit LoadIncreaseResultsHandler(elementName_type const& root_element);
+
+  /**
+   * @brief add a scenario result to the current load increase result
+   */
+  void addScenarioResult();
+
+  /**
+   * @brief return the load increase result read in xml file
+   * @return load increase result build thanks to infos read in xml file
+   */
+  boost::shared_ptr<DYNAlgorithms::LoadIncreaseResult> get() const;
+
+ protected:
+  /**
+   * @brief Called when the XML element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void create(attributes_type const& attributes);
+
+ private:
+  ScenarioResultsHandler scenarioResultsHandler_;  ///< handler used to read scenario results element
+  boost::shared_ptr<DYNAlgorithms::LoadIncreaseResult> loadIncreaseResult_;  ///< current load increase result element
+};
+
+/**
+ * @class XmlHandler
+ * @brief Aggregated results file handler class
+ *
+ * XmlHandler is the implementation of XML handler for parsing
+ * aggregated results files of a margin calculation.
+ */
+class XmlHandler : public xml::sax::parser::ComposableDocumentHandler {
+ public:
+  /**
+   * @brief Default constructor
+   */
+  XmlHandler();
+
+  /**
+   * @brief Parsed load increase results getter
+   *
+   * @return load increase results read in the file
+   */
+  const std::vector<DYNAlgorithms::LoadIncreaseResult>& getLoadIncreaseResults() const;
+
+ private:
+  /**
+   * @brief add a load increase result to the list of results read
+   */
+  void addLoadIncreaseResult();
+
+ private:
+  std::vector<DYNAlgorithms::LoadIncreaseResult> loadIncreaseResults_;  ///< load increase results read
+  LoadIncreaseResultsHandler loadIncreaseResultsHandler_;  ///< handler used to read load increase results element
+};
+
+}  // namespace aggregatedResults
+
+#endif  // API_AGGREGATEDRESULTS_DYNAGGRRESXMLHANDLER_H_
@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+#include <fstream>
+
+#include <xml/sax/parser/ParserFactory.h>
+#include <xml/sax/parser/ParserException.h>
+
+#include <DYNFileSystemUtils.h>
+#include <DYNExecUtils.h>
+
+#include "DYNAggrResXmlImporter.h"
+#include "DYNAggrResXmlHandler.h"
+#include "MacrosMessage.h"
+
+using DYNAlgorithms::LoadIncreaseResult;
+
+namespace aggregatedResults {
+
+std::vector<LoadIncreaseResult>
+XmlImporter::importLoadIncreaseResultsFromFile(const std::string& filePath) const {
+  std::ifstream stream(filePath.c_str());
+  if (!stream.is_open()) {
+    throw DYNAlgorithmsError(FileDoesNotExist, filePath);
+  }
+  try {
+    return importLoadIncreaseResultsFromStream(stream);
+  } catch (const xml::sax::parser::ParserException& exp) {
+    throw DYNAlgorithmsError(XmlParsingError, filePath, exp.what());
+  }
+}
+
+std::vector<LoadIncreaseResult>
+XmlImporter::importLoadIncreaseResultsFromStream(std::istream& stream) const {
+  XmlHandler aggregatedResultsHandler;
+
+  xml::sax::parser::ParserFactory parserFactory;
+  xml::sax::parser::ParserPtr parser = parserFactory.createParser();
+  bool xsdValidation = false;
+  if (getEnvVar("DYNAWO_USE_XSD_VALIDATION") == "true") {
+    const std::string xsdPath = createAbsolutePath("aggregatedResults.xsd", getMandatoryEnvVar("DYNAWO_ALGORITHMS_XSD_DIR"));
+    parser->addXmlSchema(xsdPath);
+    xsdValidation = true;
+  }
+  parser->parse(stream, aggregatedResultsHandler, xsdValidation);
+  return aggregatedResultsHandler.getLoadIncreaseResults();
+}
+
+}  // namespace aggregatedResults
@@ -0,0 +1,51 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+#ifndef API_AGGREGATEDRESULTS_DYNAGGRRESXMLIMPORTER_H_
+#define API_AGGREGATEDRESULTS_DYNAGGRRESXMLIMPORTER_H_
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "DYNLoadIncreaseResult.h"
+
+namespace aggregatedResults {
+/**
+ * @class XmlImporter
+ * @brief aggregated results XML importer class
+ *
+ * XML import class for aggregated results, used to reuse the results of a previous run
+ */
+class XmlImporter {
+ public:
+  /**
+   * @brief Import load increase results from a file
+   *
+   * @param filePath file containing the aggregated results of a margin calculation
+   * @return load increase results read in the file
+   */
+  std::vector<DYNAlgorithms::LoadIncreaseResult> importLoadIncreaseResultsFromFile(const std::string& filePath) const;
+
+  /**
+   * @brief Import load increase results from a stream
+   *
+   * @param stream stream containing the aggregated results of a margin calculation
+   * @return load increase results read in the stream
+   */
+  std::vector<DYNAlgorithms::LoadIncreaseResult> importLoadIncreaseResultsFromStream(std::istream& stream) const;
+};
+
+}  // namespace aggregatedResults
+
+#endif  // API_AGGREGATEDRESULTS_DYNAGGRRESXMLIMPORTER_H_
@@ -20,6 +20,7 @@
 #include "DYNSimulationResult.h"
 #include "DYNCriticalTimeResult.h"
 #include "DYNAggrResXmlExporter.h"
+#include "DYNAggrResXmlImporter.h"
 
 namespace aggregatedResults {
 
@@ -28,6 +29,7 @@ TEST(TestAggregatedResults, TestAggregatedResultsScenariosResults) {
   results[0].setScenarioId("MyFirstScenario");
   results[0].setSuccess(true);
   results[0].setStatus(DYNAlgorithms::CONVERGENCE_STATUS);
+  results[0].setSteadyStateTime(25.5);
   results[1].setScenarioId("MySecondScenario");
   results[1].setSuccess(false);
   results[1].setStatus(DYNAlgorithms::CRITERIA_NON_RESPECTED_STATUS);
@@ -37,6 +39,7 @@ TEST(TestAggregatedResults, TestAggregatedResultsScenariosResults) {
   results[2].setScenarioId("MyThirdScenario");
   results[2].setSuccess(false);
   results[2].setStatus(DYNAlgorithms::DIVERGENCE_STATUS);
+  results[2].setScreening(true);
 
   XmlExporter exporter;
   exporter.exportScenarioResultsToFile(results, "res/scenarioResults.xml");
@@ -53,8 +56,32 @@ TEST(TestAggregatedResults, TestAggregatedResultsScenariosResults) {
   ASSERT_EQ(ssDiff.str(), ssCmd.str());
 }
 
+TEST(TestAggregatedResults, TestAggregatedResultsStreamedScenarioResult) {
+  DYNAlgorithms::SimulationResult result;
+  result.setScenarioId("MySecondScenario");
+  result.setSuccess(false);
+  result.setStatus(DYNAlgorithms::CRITERIA_NON_RESPECTED_STATUS);
+  std::vector<std::pair<double, std::string> > failingCriteria;
+  failingCriteria.push_back(std::make_pair(10, "MyCriteria"));
+  result.setFailingCriteria(failingCriteria);
+  result.setScreening(true);
+
+  XmlExporter exporter;
+  std::stringstream stream;
+  exporter.exportScenarioResultToStream(result, stream);
+  const std::string fragment = stream.str();
+  ASSERT_EQ(fragment.find("<?xml"), std::string::npos);
+  ASSERT_EQ(fragment.find("aggregatedResults"), std::string::npos);
+  ASSERT_NE(fragment.find("<scenarioResults"), std::string::npos);
+  ASSERT_NE(fragment.find("id=\"MySecondScenario\""), std::string::npos);
+  ASSERT_NE(fragment.find("status=\"CRITERIA_NON_RESPECTED\""), std::string::npos);
+  ASSERT_NE(fragment.find("screening=\"true\""), std::string::npos);
+  ASSERT_NE(fragment.find("id=\"MyCriteria\""), std::string::npos);
+}
+
 TEST(TestAggregatedResults, TestAggregatedResultsLoadIncreaseResults) {
   DYNAlgorithms::LoadIncreaseResult loadIncreaseResult1(3);
+  loadIncreaseResult1.setScreening(true);
   loadIncreaseResult1.getResult().setVariation(0.);
   loadIncreaseResult1.getResult().setStatus(DYNAlgorithms::CONVERGENCE_STATUS);
   loadIncreaseResult1.getScenarioResult(0).setScenarioId("MyFirstScenario");
@@ -85,13 +112,22 @@ TEST(TestAggregatedResults, TestAggregatedResultsLoadIncreaseResults) {
   loadIncreaseResult2.getScenarioResult(2).setStatus(DYNAlgorithms::DIVERGENCE_STATUS);
 
   DYNAlgorithms::LoadIncreaseResult loadIncreaseResult3(3);
+  loadIncreaseResult3.setLoadIncreaseId("MyLoadIncrease");
   loadIncreaseResult3.getResult().setVariation(50.);
   loadIncreaseResult3.getResult().setStatus(DYNAlgorithms::DIVERGENCE_STATUS);
 
+  DYNAlgorithms::LoadIncreaseResult loadIncreaseResult4(1);
+  loadIncreaseResult4.setDecided(true);
+  loadIncreaseResult4.getResult().setVariation(75.);
+  loadIncreaseResult4.getScenarioResult(0).setScenarioId("MyFirstScenario");
+  loadIncreaseResult4.getScenarioResult(0).setSuccess(true);
+  loadIncreaseResult4.getScenarioResult(0).setStatus(DYNAlgorithms::CONVERGENCE_STATUS);
+
   std::vector<DYNAlgorithms::LoadIncreaseResult> liResults;
   liResults.push_back(loadIncreaseResult1);
   liResults.push_back(loadIncreaseResult2);
   liResults.push_back(loadIncreaseResult3);
+  liResults.push_back(loadIncreaseResult4);
 
   XmlExporter exporter;
   exporter.exportLoadIncreaseResultsToFile(liResults, "res/loadIncreaseResults.xml");
@@ -108,11 +144,51 @@ TEST(TestAggregatedResults, TestAggregatedResultsLoadIncreaseResults) {
   ASSERT_EQ(ssDiff.str(), ssCmd.str());
 }
 
+TEST(TestAggregatedResults, TestAggregatedResultsImportLoadIncreaseResults) {
+  XmlImporter importer;
+  std::vector<DYNAlgorithms::LoadIncreaseResult> liResults = importer.importLoadIncreaseResultsFromFile("res/loadIncreaseResultsRef.xml");
+  ASSERT_EQ(liResults.size(), 4);
+
+  ASSERT_TRUE(liResults[0].getLoadIncreaseId().empty());
+  ASSERT_TRUE(liResults[0].isScreening());
+  ASSERT_FALSE(liResults[0].isDecided());
+  ASSERT_EQ(liResults[0].getResult().getVariation(), 0.);
+  ASSERT_EQ(liResults[0].getResult().getStatus(), DYNAlgorithms::CONVERGENCE_STATUS);
+  ASSERT_TRUE(liResults[0].getResult().getSuccess());
+  ASSERT_EQ(liResults[0].getScenariosResults().size(), 3);
+  ASSERT_EQ(liResults[0].getScenariosResults()[0].getScenarioId(), "MyFirstScenario");
+  ASSERT_EQ(liResults[0].getScenariosResults()[0].getStatus(), DYNAlgorithms::CONVERGENCE_STATUS);
+
+  ASSERT_EQ(liResults[1].getResult().getVariation(), 100.);
+  ASSERT_EQ(liResults[1].getScenariosResults().size(), 3);
+  ASSERT_EQ(liResults[1].getScenariosResults()[1].getScenarioId(), "MySecondScenario");
+  ASSERT_EQ(liResults[1].getScenariosResults()[1].getVariation(), 100.);
+  ASSERT_EQ(liResults[1].getScenariosResults()[1].getStatus(), DYNAlgorithms::CRITERIA_NON_RESPECTED_STATUS);
+  ASSERT_FALSE(liResults[1].getScenariosResults()[1].getSuccess());
+  ASSERT_EQ(liResults[1].getScenariosResults()[2].getStatus(), DYNAlgorithms::DIVERGENCE_STATUS);
+
+  ASSERT_EQ(liResults[2].getLoadIncreaseId(), "MyLoadIncrease");
+  ASSERT_FALSE(liResults[2].isScreening());
+  ASSERT_EQ(liResults[2].getResult().getVariation(), 50.);
+  ASSERT_EQ(liResults[2].getResult().getStatus(), DYNAlgorithms::DIVERGENCE_STATUS);
+  ASSERT_FALSE(liResults[2].getResult().getSuccess());
+  ASSERT_TRUE(liResults[2].getScenariosResults().empty());
+
+  // the load increase of a decided level was not simulated: it has no status of its own
+  ASSERT_TRUE(liResults[3].isDecided());
+  ASSERT_EQ(liResults[3].getResult().getVariation(), 75.);
+  ASSERT_EQ(liResults[3].getResult().getStatus(), DYNAlgorithms::EXECUTION_PROBLEM_STATUS);
+  ASSERT_FALSE(liResults[3].getResult().getSuccess());
+  ASSERT_EQ(liResults[3].getScenariosResults().size(), 1);
+  ASSERT_EQ(liResults[3].getScenariosResults()[0].getStatus(), DYNAlgorithms::CONVERGENCE_STATUS);
+}
+
 TEST(TestAggregatedResults, TestAggregatedResultsCriticalTimeResults) {
   DYNAlgorithms::CriticalTimeResult criticalTimeResult1;
   criticalTimeResult1.setId("MyFirstScenario");
   criticalTimeResult1.setStatus(DYNAlgorithms::RESULT_FOUND_STATUS);
   criticalTimeResult1.setCriticalTime(1);
+  criticalTimeResult1.setInstability(1.5, "GEN1 generator_omegaPu_value above 1.02");
 
   DYNAlgorithms::CriticalTimeResult criticalTimeResult2;
   criticalTimeResult2.setId("MySecondScenario");
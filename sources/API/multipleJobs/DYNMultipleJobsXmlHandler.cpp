@@ -21,6 +21,8 @@
  */
 #include "DYNMultipleJobsXmlHandler.h"
 
+#include <limits>
+
 #include <xml/sax/parser/Attributes.h>
 
 #include <boost/phoenix/core.hpp>
@@ -33,6 +35,8 @@
 #include "DYNCriticalTimeCalculation.h"
 #include "DYNScenarios.h"
 #include "DYNScenario.h"
+#include "DYNSteadyStateDetection.h"
+#include "DYNInstabilityDetection.h"
 
 namespace lambda = boost::phoenix;
 namespace lambda_args = lambda::placeholders;
@@ -42,6 +46,8 @@ xml::sax::parser::namespace_uri multipleJobs_ns("http://www.rte-france.com/dynaw
 
 using DYNAlgorithms::Scenarios;
 using DYNAlgorithms::Scenario;
+using DYNAlgorithms::SteadyStateDetection;
+using DYNAlgorithms::InstabilityDetection;
 using DYNAlgorithms::MarginCalculation;
 using DYNAlgorithms::LoadIncrease;
 using DYNAlgorithms::CriticalTimeCalculation;
@@ -91,7 +97,7 @@ loadIncreaseHandler_(parser::ElementName(multipleJobs_ns, "loadIncrease")) {
   onElement(root_element + multipleJobs_ns("loadIncrease"), loadIncreaseHandler_);
 
   scenariosHandler_.onEnd(lambda::bind(&MarginCalculationHandler::addScenarios, lambda::ref(*this)));
-  loadIncreaseHandler_.onEnd(lambda::bind(&MarginCalculationHandler::setLoadIncrease, lambda::ref(*this)));
+  loadIncreaseHandler_.onEnd(lambda::bind(&MarginCalculationHandler::addLoadIncrease, lambda::ref(*this)));
 }
 
 void
@@ -105,6 +111,14 @@ MarginCalculationHandler::create(attributes_type const& attributes) {
 
   if (attributes.has("accuracy"))
     marginCalculation_->setAccuracy(attributes["accuracy"]);
+  if (attributes.has("previousResultsFile"))
+    marginCalculation_->setPreviousResultsFile(attributes["previousResultsFile"]);
+  if (attributes.has("archiveLoadIncreaseStates"))
+    marginCalculation_->setArchiveLoadIncreaseStates(attributes["archiveLoadIncreaseStates"]);
+  if (attributes.has("screeningDuration"))
+    marginCalculation_->setScreeningDuration(attributes["screeningDuration"]);
+  if (attributes.has("levelSelection") && attributes["levelSelection"].as_string() == "ACTIVE_LEARNING")
+    marginCalculation_->setLevelSelection(MarginCalculation::ACTIVE_LEARNING);
 }
 
 void
@@ -113,8 +127,8 @@ MarginCalculationHandler::addScenarios() {
 }
 
 void
-MarginCalculationHandler::setLoadIncrease() {
-  marginCalculation_->setLoadIncrease(loadIncreaseHandler_.get());
+MarginCalculationHandler::addLoadIncrease() {
+  marginCalculation_->addLoadIncrease(loadIncreaseHandler_.get());
 }
 
 boost::shared_ptr<MarginCalculation>
@@ -123,12 +137,17 @@ MarginCalculationHandler::get() const {
 }
 
 CriticalTimeCalculationHandler::CriticalTimeCalculationHandler(const elementName_type& root_element) :
-scenariosHandler_(parser::ElementName(multipleJobs_ns, "scenarios")) {
+scenariosHandler_(parser::ElementName(multipleJobs_ns, "scenarios")),
+instabilityDetectionHandler_(parser::ElementName(multipleJobs_ns, "instabilityDetection")) {
   onStartElement(root_element, lambda::bind(&CriticalTimeCalculationHandler::create, lambda::ref(*this), lambda_args::arg2));
 
   onElement(root_element + multipleJobs_ns("scenarios"), scenariosHandler_);
+  onElement(root_element + multipleJobs_ns("instabilityDetection"), instabilityDetectionHandler_);
+  onStartElement(root_element + multipleJobs_ns("target"),
+      lambda::bind(&CriticalTimeCalculationHandler::addTarget, lambda::ref(*this), lambda_args::arg2));
 
   scenariosHandler_.onEnd(lambda::bind(&CriticalTimeCalculationHandler::addScenarios, lambda::ref(*this)));
+  instabilityDetectionHandler_.onEnd(lambda::bind(&CriticalTimeCalculationHandler::setInstabilityDetection, lambda::ref(*this)));
 }
 
 void
@@ -143,6 +162,33 @@ CriticalTimeCalculationHandler::create(attributes_type const& attributes) {
     criticalTimeCalculation_->setMode(CriticalTimeCalculation::COMPLEX);
   else
     criticalTimeCalculation_->setMode(CriticalTimeCalculation::SIMPLE);
+  if (attributes.has("preFaultTime"))
+    criticalTimeCalculation_->setPreFaultTime(attributes["preFaultTime"]);
+  if (attributes.has("faultOnBranching"))
+    criticalTimeCalculation_->setFaultOnBranching(attributes["faultOnBranching"]);
+  if (attributes.has("interpolatedSearch"))
+    criticalTimeCalculation_->setInterpolatedSearch(attributes["interpolatedSearch"]);
+  if (attributes.has("priorMargin"))
+    criticalTimeCalculation_->setPriorMargin(attributes["priorMargin"]);
+}
+
+void
+CriticalTimeCalculationHandler::addTarget(attributes_type const& attributes) {
+  // the attributes not given are the ones of the critical time calculation
+  CriticalTimeCalculation::Target target;
+  target.id_ = attributes["id"].as_string();
+  target.parName_ = criticalTimeCalculation_->getParName();
+  target.minValue_ = criticalTimeCalculation_->getMinValue();
+  target.maxValue_ = criticalTimeCalculation_->getMaxValue();
+  if (attributes.has("dydId"))
+    target.dydId_ = attributes["dydId"].as_string();
+  if (attributes.has("parName"))
+    target.parName_ = attributes["parName"].as_string();
+  if (attributes.has("minValue"))
+    target.minValue_ = attributes["minValue"];
+  if (attributes.has("maxValue"))
+    target.maxValue_ = attributes["maxValue"];
+  criticalTimeCalculation_->addTarget(target);
 }
 
 void
@@ -150,6 +196,11 @@ CriticalTimeCalculationHandler::addScenarios() {
   criticalTimeCalculation_->setScenarios(scenariosHandler_.get());
 }
 
+void
+CriticalTimeCalculationHandler::setInstabilityDetection() {
+  criticalTimeCalculation_->setInstabilityDetection(instabilityDetectionHandler_.get());
+}
+
 CriticalTimeCalculationHandler::~CriticalTimeCalculationHandler() {
 }
 
@@ -159,18 +210,37 @@ CriticalTimeCalculationHandler::get() {
 }
 
 ScenariosHandler::ScenariosHandler(const elementName_type& root_element) :
-scenarioHandler_(parser::ElementName(multipleJobs_ns, "scenario")) {
+scenarioHandler_(parser::ElementName(multipleJobs_ns, "scenario")),
+steadyStateDetectionHandler_(parser::ElementName(multipleJobs_ns, "steadyStateDetection")) {
   onStartElement(root_element, lambda::bind(&ScenariosHandler::create, lambda::ref(*this), lambda_args::arg2));
 
   onElement(root_element + multipleJobs_ns("scenario"), scenarioHandler_);
+  onElement(root_element + multipleJobs_ns("steadyStateDetection"), steadyStateDetectionHandler_);
 
   scenarioHandler_.onEnd(lambda::bind(&ScenariosHandler::addScenario, lambda::ref(*this)));
+  steadyStateDetectionHandler_.onEnd(lambda::bind(&ScenariosHandler::setSteadyStateDetection, lambda::ref(*this)));
 }
 
 void
 ScenariosHandler::create(attributes_type const& attributes) {
   scenarios_ = boost::shared_ptr<Scenarios>(new Scenarios());
   scenarios_->setJobsFile(attributes["jobsFile"]);
+  if (attributes.has("initialization")) {
+    if (attributes["initialization"].as_string() == "SHARED")
+      scenarios_->setInitialization(Scenarios::INIT_SHARED);
+    else if (attributes["initialization"].as_string() == "SHARED_PER_PROCESS")
+      scenarios_->setInitialization(Scenarios::INIT_SHARED_PER_PROCESS);
+  }
+  if (attributes.has("resultsCacheDirectory"))
+    scenarios_->setResultsCacheDirectory(attributes["resultsCacheDirectory"]);
+  if (attributes.has("screeningDuration"))
+    scenarios_->setScreeningDuration(attributes["screeningDuration"]);
+  if (attributes.has("outputsRetention")) {
+    if (attributes["outputsRetention"].as_string() == "NON_CONVERGENCE")
+      scenarios_->setOutputsRetention(Scenarios::OUTPUTS_NON_CONVERGENCE);
+    else if (attributes["outputsRetention"].as_string() == "CRITERIA_NON_RESPECTED")
+      scenarios_->setOutputsRetention(Scenarios::OUTPUTS_CRITERIA_NON_RESPECTED);
+  }
 }
 
 void
@@ -178,13 +248,76 @@ ScenariosHandler::addScenario() {
   scenarios_->addScenario(scenarioHandler_.get());
 }
 
+void
+ScenariosHandler::setSteadyStateDetection() {
+  scenarios_->setSteadyStateDetection(steadyStateDetectionHandler_.get());
+}
+
 boost::shared_ptr<Scenarios>
 ScenariosHandler::get() const {
   return scenarios_;
 }
 
+SteadyStateDetectionHandler::SteadyStateDetectionHandler(const elementName_type& root_element) {
+  onStartElement(root_element, lambda::bind(&SteadyStateDetectionHandler::create, lambda::ref(*this), lambda_args::arg2));
+  onStartElement(root_element + multipleJobs_ns("variable"),
+      lambda::bind(&SteadyStateDetectionHandler::addVariable, lambda::ref(*this), lambda_args::arg2));
+}
+
+void
+SteadyStateDetectionHandler::create(attributes_type const& attributes) {
+  steadyStateDetection_ = boost::shared_ptr<SteadyStateDetection>(new SteadyStateDetection());
+  if (attributes.has("window"))
+    steadyStateDetection_->setWindow(attributes["window"]);
+  if (attributes.has("threshold"))
+    steadyStateDetection_->setThreshold(attributes["threshold"]);
+}
+
+void
+SteadyStateDetectionHandler::addVariable(attributes_type const& attributes) {
+  steadyStateDetection_->addVariable(attributes["model"], attributes["name"]);
+}
+
+boost::shared_ptr<SteadyStateDetection>
+SteadyStateDetectionHandler::get() const {
+  return steadyStateDetection_;
+}
+
+InstabilityDetectionHandler::InstabilityDetectionHandler(const elementName_type& root_element) {
+  onStartElement(root_element, lambda::bind(&InstabilityDetectionHandler::create, lambda::ref(*this), lambda_args::arg2));
+  onStartElement(root_element + multipleJobs_ns("variable"),
+      lambda::bind(&InstabilityDetectionHandler::addVariable, lambda::ref(*this), lambda_args::arg2));
+}
+
+void
+InstabilityDetectionHandler::create(attributes_type const& attributes) {
+  instabilityDetection_ = boost::shared_ptr<InstabilityDetection>(new InstabilityDetection());
+  if (attributes.has("window"))
+    instabilityDetection_->setWindow(attributes["window"]);
+}
+
+void
+InstabilityDetectionHandler::addVariable(attributes_type const& attributes) {
+  double minValue = std::numeric_limits<double>::lowest();
+  double maxValue = std::numeric_limits<double>::max();
+  if (attributes.has("minValue"))
+    minValue = attributes["minValue"];
+  if (attributes.has("maxValue"))
+    maxValue = attributes["maxValue"];
+  instabilityDetection_->addVariable(attributes["model"], attributes["name"], minValue, maxValue);
+}
+
+boost::shared_ptr<InstabilityDetection>
+InstabilityDetectionHandler::get() const {
+  return instabilityDetection_;
+}
+
 ScenarioHandler::ScenarioHandler(const elementName_type& root_element) {
   onStartElement(root_element, lambda::bind(&ScenarioHandler::create, lambda::ref(*this), lambda_args::arg2));
+  onStartElement(root_element + multipleJobs_ns("event"), lambda::bind(&ScenarioHandler::createEvent, lambda::ref(*this), lambda_args::arg2));
+  onStartElement(root_element + multipleJobs_ns("event") + multipleJobs_ns("parameter"),
+      lambda::bind(&ScenarioHandler::addEventParameter, lambda::ref(*this), lambda_args::arg2));
+  onEndElement(root_element + multipleJobs_ns("event"), lambda::bind(&ScenarioHandler::addEvent, lambda::ref(*this)));
 }
 
 void
@@ -197,6 +330,37 @@ ScenarioHandler::create(attributes_type const& attributes) {
     scenario_->setDydId(attributes["dydId"]);
   if (attributes.has("criteriaFile"))
     scenario_->setCriteriaFile(attributes["criteriaFile"]);
+  if (attributes.has("group"))
+    scenario_->setGroup(attributes["group"]);
+}
+
+void
+ScenarioHandler::createEvent(attributes_type const& attributes) {
+  event_ = boost::shared_ptr<Scenario::Event>(new Scenario::Event());
+  event_->elementId_ = attributes["elementId"].as_string();
+  if (attributes["type"].as_string() == "INJECTION_DISCONNECTION")
+    event_->type_ = Scenario::Event::INJECTION_DISCONNECTION;
+  else
+    event_->type_ = Scenario::Event::BRANCH_DISCONNECTION;
+  event_->time_ = attributes["time"];
+  if (attributes.has("modelId"))
+    event_->modelId_ = attributes["modelId"].as_string();
+  if (attributes.has("variable"))
+    event_->variable_ = attributes["variable"].as_string();
+}
+
+void
+ScenarioHandler::addEventParameter(attributes_type const& attributes) {
+  Scenario::Event::Parameter parameter;
+  parameter.name_ = attributes["name"].as_string();
+  parameter.type_ = attributes["type"].as_string();
+  parameter.value_ = attributes["value"].as_string();
+  event_->parameters_.push_back(parameter);
+}
+
+void
+ScenarioHandler::addEvent() {
+  scenario_->addEvent(*event_);
 }
 
 boost::shared_ptr<Scenario>
@@ -24,9 +24,12 @@
 #include <xml/sax/parser/ComposableDocumentHandler.h>
 #include <xml/sax/parser/ComposableElementHandler.h>
 
+#include "DYNScenario.h"
+
 namespace DYNAlgorithms {
-class Scenario;
 class Scenarios;
+class SteadyStateDetection;
+class InstabilityDetection;
 class MarginCalculation;
 class CriticalTimeCalculation;
 class LoadIncrease;
@@ -59,10 +62,97 @@ class ScenarioHandler : public xml::sax::parser::ComposableElementHandler {
    */
   void create(attributes_type const& attributes);
 
+  /**
+   * @brief called when an event element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void createEvent(attributes_type const& attributes);
+
+  /**
+   * @brief called when a parameter element of an event opening tag is read
+   * @param attributes attributes of the element
+   */
+  void addEventParameter(attributes_type const& attributes);
+
+  /**
+   * @brief called when an event element closing tag is read
+   */
+  void addEvent();
+
  private:
   boost::shared_ptr<DYNAlgorithms::Scenario> scenario_;  ///< current scenario
+  boost::shared_ptr<DYNAlgorithms::Scenario::Event> event_;  ///< current event of the scenario
 };
 
+/**
+ * @class SteadyStateDetectionHandler
+ * @brief Handler used to parse steady state detection element
+ */
+class SteadyStateDetectionHandler : public xml::sax::parser::ComposableElementHandler {
+ public:
+  /**
+   * @brief Constructor
+   * @param root_element complete name of the element read by the handler
+   */
+  explicit SteadyStateDetectionHandler(elementName_type const& root_element);
+
+  /**
+   * @brief return the current steady state detection read in xml file
+   * @return steady state detection object build thanks to infos read in xml file
+   */
+  boost::shared_ptr<DYNAlgorithms::SteadyStateDetection> get() const;
+
+ protected:
+  /**
+   * @brief called when the XML element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void create(attributes_type const& attributes);
+
+  /**
+   * @brief called when a monitored variable element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void addVariable(attributes_type const& attributes);
+
+ private:
+  boost::shared_ptr<DYNAlgorithms::SteadyStateDetection> steadyStateDetection_;  ///< current steady state detection
+};
+
+/**
+ * @class InstabilityDetectionHandler
+ * @brief Handler used to parse instability detection element
+ */
+class InstabilityDetectionHandler : public xml::sax::parser::ComposableElementHandler {
+ public:
+  /**
+   * @brief Constructor
+   * @param root_element complete name of the element read by the handler
+   */
+  explicit InstabilityDetectionHandler(elementName_type const& root_element);
+
+  /**
+   * @brief return the current instability detection read in xml file
+   * @return instability detection object build thanks to infos read in xml file
+   */
+  boost::shared_ptr<DYNAlgorithms::InstabilityDetection> get() const;
+
+ protected:
+  /**
+   * @brief called when the XML element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void create(attributes_type const& attributes);
+
+  /**
+   * @brief called when a monitored variable element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void addVariable(attributes_type const& attributes);
+
+ private:
+  boost::shared_ptr<DYNAlgorithms::InstabilityDetection> instabilityDetection_;  ///< current instability detection
+};
 
 /**
  * @class LoadIncreaseHandler
@@ -110,6 +200,11 @@ class ScenariosHandler : public xml::sax::parser::ComposableElementHandler {
    */
   void addScenario();
 
+  /**
+   * @brief set the steady state detection
+   */
+  void setSteadyStateDetection();
+
   /**
    * @brief return the scenarios read in xml file
    * @return scenarios object build thanks to infos read in xml file
@@ -125,6 +220,7 @@ class ScenariosHandler : public xml::sax::parser::ComposableElementHandler {
 
  private:
   ScenarioHandler scenarioHandler_;  ///< handler used to scenario element
+  SteadyStateDetectionHandler steadyStateDetectionHandler_;  ///< handler used to read steady state detection element
   boost::shared_ptr<DYNAlgorithms::Scenarios> scenarios_;  ///< current scenarios
 };
 
@@ -146,9 +242,9 @@ class MarginCalculationHandler : public xml::sax::parser::ComposableElementHandl
   void addScenarios();
 
   /**
-   * @brief set the load increase element
+   * @brief add a load increase element
    */
-  void setLoadIncrease();
+  void addLoadIncrease();
 
   /**
    * @brief return the margin calculation read in xml file
@@ -186,6 +282,11 @@ class CriticalTimeCalculationHandler : public xml::sax::parser::ComposableElemen
    */
   void addScenarios();
 
+  /**
+   * @brief set the instability detection
+   */
+  void setInstabilityDetection();
+
   /**
    * @brief default destructor
    */
@@ -204,9 +305,16 @@ class CriticalTimeCalculationHandler : public xml::sax::parser::ComposableElemen
    */
   void create(attributes_type const& attributes);
 
+  /**
+   * @brief called when a target element opening tag is read
+   * @param attributes attributes of the element
+   */
+  void addTarget(attributes_type const& attributes);
+
  private:
   std::shared_ptr<DYNAlgorithms::CriticalTimeCalculation> criticalTimeCalculation_;  ///< current critical time calculation element
   ScenariosHandler scenariosHandler_;  ///< handler used to read scenarios element
+  InstabilityDetectionHandler instabilityDetectionHandler_;  ///< handler used to read instability detection element
 };
 
 /**
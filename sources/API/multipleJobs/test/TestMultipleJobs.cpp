@@ -12,6 +12,7 @@
 //
 
 #include <fstream>
+#include <limits>
 
 #include <xml/sax/parser/ParserFactory.h>
 
@@ -79,9 +80,16 @@ TEST(TestMultipleJobs, TestMultipleJobsXmlHandlerMarginCalculation) {
   boost::shared_ptr<DYNAlgorithms::MarginCalculation> mc = mj->getMarginCalculation();
   ASSERT_EQ(mc->getAccuracy(), 50);
   ASSERT_EQ(mc->getCalculationType(), DYNAlgorithms::MarginCalculation::LOCAL_MARGIN);
+  ASSERT_EQ(mc->getPreviousResultsFile(), "previousAggregatedResults.xml");
+  ASSERT_TRUE(mc->getArchiveLoadIncreaseStates());
+  ASSERT_DOUBLE_EQ(mc->getScreeningDuration(), 2.5);
+  ASSERT_EQ(mc->getLevelSelection(), DYNAlgorithms::MarginCalculation::ACTIVE_LEARNING);
   assert(mc->getLoadIncrease());
   ASSERT_EQ(mc->getLoadIncrease()->getId(), "MyLoadIncrease");
   ASSERT_EQ(mc->getLoadIncrease()->getJobsFile(), "MyLoadIncrease.jobs");
+  ASSERT_EQ(mc->getLoadIncreases().size(), 2);
+  ASSERT_EQ(mc->getLoadIncreases()[1]->getId(), "MyLoadIncrease2");
+  ASSERT_EQ(mc->getLoadIncreases()[1]->getJobsFile(), "MyLoadIncrease2.jobs");
   ASSERT_EQ(mc->getScenarios()->getScenarios().size(), 2);
   ASSERT_EQ(mc->getScenarios()->getScenarios()[0]->getId(), "MyScenario");
   ASSERT_EQ(mc->getScenarios()->getScenarios()[0]->getDydFile(), "MyScenario.dyd");
@@ -90,6 +98,10 @@ TEST(TestMultipleJobs, TestMultipleJobsXmlHandlerMarginCalculation) {
   ASSERT_EQ(mc->getScenarios()->getScenarios()[1]->getDydFile(), "MyScenario2.dyd");
   ASSERT_EQ(mc->getScenarios()->getScenarios()[1]->getCriteriaFile(), "MyScenario2.crt");
   ASSERT_EQ(mc->getScenarios()->getJobsFile(), "myScenarios.jobs");
+  ASSERT_EQ(mc->getScenarios()->getInitialization(), DYNAlgorithms::Scenarios::INIT_EACH_SCENARIO);
+  ASSERT_TRUE(mc->getScenarios()->getResultsCacheDirectory().empty());
+  ASSERT_DOUBLE_EQ(mc->getScenarios()->getScreeningDuration(), 0.);
+  ASSERT_EQ(mc->getScenarios()->getOutputsRetention(), DYNAlgorithms::Scenarios::OUTPUTS_ALL);
 }
 
 TEST(TestMultipleJobs, TestMultipleJobsXmlHandlerScenarios) {
@@ -112,7 +124,38 @@ TEST(TestMultipleJobs, TestMultipleJobsXmlHandlerScenarios) {
   ASSERT_EQ(scenarios->getScenarios()[1]->getId(), "MyScenario2");
   ASSERT_EQ(scenarios->getScenarios()[1]->getDydFile(), "MyScenario2.dyd");
   ASSERT_EQ(scenarios->getScenarios()[1]->getCriteriaFile(), "MyScenario2.crt");
+  ASSERT_TRUE(scenarios->getScenarios()[0]->getEvents().empty());
+  const std::vector<DYNAlgorithms::Scenario::Event>& events = scenarios->getScenarios()[1]->getEvents();
+  ASSERT_EQ(events.size(), 2);
+  ASSERT_EQ(events[0].elementId_, "MyLine");
+  ASSERT_EQ(events[0].type_, DYNAlgorithms::Scenario::Event::BRANCH_DISCONNECTION);
+  ASSERT_DOUBLE_EQ(events[0].time_, 1.);
+  ASSERT_TRUE(events[0].modelId_.empty());
+  ASSERT_TRUE(events[0].variable_.empty());
+  ASSERT_TRUE(events[0].parameters_.empty());
+  ASSERT_EQ(events[1].elementId_, "MyLoad");
+  ASSERT_EQ(events[1].type_, DYNAlgorithms::Scenario::Event::INJECTION_DISCONNECTION);
+  ASSERT_DOUBLE_EQ(events[1].time_, 1.5);
+  ASSERT_EQ(events[1].modelId_, "MyLoadModel");
+  ASSERT_EQ(events[1].variable_, "load_state_value");
+  ASSERT_EQ(events[1].parameters_.size(), 1);
+  ASSERT_EQ(events[1].parameters_[0].name_, "event_open");
+  ASSERT_EQ(events[1].parameters_[0].type_, "BOOL");
+  ASSERT_EQ(events[1].parameters_[0].value_, "false");
   ASSERT_EQ(scenarios->getJobsFile(), "myScenarios.jobs");
+  ASSERT_EQ(scenarios->getInitialization(), DYNAlgorithms::Scenarios::INIT_SHARED_PER_PROCESS);
+  ASSERT_EQ(scenarios->getResultsCacheDirectory(), "resultsCache");
+  ASSERT_DOUBLE_EQ(scenarios->getScreeningDuration(), 2.5);
+  ASSERT_EQ(scenarios->getOutputsRetention(), DYNAlgorithms::Scenarios::OUTPUTS_NON_CONVERGENCE);
+  boost::shared_ptr<DYNAlgorithms::SteadyStateDetection> steadyStateDetection = scenarios->getSteadyStateDetection();
+  assert(steadyStateDetection);
+  ASSERT_DOUBLE_EQ(steadyStateDetection->getWindow(), 5.);
+  ASSERT_DOUBLE_EQ(steadyStateDetection->getThreshold(), 0.001);
+  ASSERT_EQ(steadyStateDetection->getVariables().size(), 2);
+  ASSERT_EQ(steadyStateDetection->getVariables()[0].first, "GEN1");
+  ASSERT_EQ(steadyStateDetection->getVariables()[0].second, "generator_omegaPu_value");
+  ASSERT_EQ(steadyStateDetection->getVariables()[1].first, "NETWORK");
+  ASSERT_EQ(steadyStateDetection->getVariables()[1].second, "BUS1_Upu_value");
 }
 
 TEST(TestMultipleJobs, TestMultipleJobsXmlHanderCriticalTime) {
@@ -136,14 +179,43 @@ TEST(TestMultipleJobs, TestMultipleJobsXmlHanderCriticalTime) {
   ASSERT_EQ(ct->getMinValue(), 0.1);
   ASSERT_EQ(ct->getMaxValue(), 1);
   ASSERT_EQ(ct->getMode(), DYNAlgorithms::CriticalTimeCalculation::SIMPLE);
+  ASSERT_DOUBLE_EQ(ct->getPreFaultTime(), 0.5);
+  ASSERT_TRUE(ct->getFaultOnBranching());
+  ASSERT_TRUE(ct->getInterpolatedSearch());
+  ASSERT_DOUBLE_EQ(ct->getPriorMargin(), 0.05);
   boost::shared_ptr<DYNAlgorithms::Scenarios> scenarios = ct->getScenarios();
   ASSERT_EQ(ct->getScenarios()->getJobsFile(), "Myjobs.jobs");
   ASSERT_EQ(ct->getScenarios()->getScenarios().size(), 2);
   ASSERT_EQ(ct->getScenarios()->getScenarios()[0]->getId(), "MyScenarioId1");
   ASSERT_EQ(ct->getScenarios()->getScenarios()[0]->getDydFile(), "MyDydFile1.dyd");
   ASSERT_EQ(ct->getScenarios()->getScenarios()[0]->getDydId(), "MyDydId");
+  ASSERT_TRUE(ct->getScenarios()->getScenarios()[0]->getGroup().empty());
   ASSERT_EQ(ct->getScenarios()->getScenarios()[1]->getId(), "MyScenarioId2");
   ASSERT_EQ(ct->getScenarios()->getScenarios()[1]->getDydFile(), "MyDydFile2.dyd");
   ASSERT_EQ(ct->getScenarios()->getScenarios()[1]->getDydId(), "MyDydId2");
+  ASSERT_EQ(ct->getScenarios()->getScenarios()[1]->getGroup(), "MyGroup");
+  boost::shared_ptr<DYNAlgorithms::InstabilityDetection> instabilityDetection = ct->getInstabilityDetection();
+  assert(instabilityDetection);
+  ASSERT_DOUBLE_EQ(instabilityDetection->getWindow(), 0.05);
+  ASSERT_EQ(instabilityDetection->getVariables().size(), 2);
+  ASSERT_EQ(instabilityDetection->getVariables()[0].modelId_, "GEN1");
+  ASSERT_EQ(instabilityDetection->getVariables()[0].variableName_, "generator_omegaPu_value");
+  ASSERT_DOUBLE_EQ(instabilityDetection->getVariables()[0].minValue_, 0.98);
+  ASSERT_DOUBLE_EQ(instabilityDetection->getVariables()[0].maxValue_, 1.02);
+  ASSERT_EQ(instabilityDetection->getVariables()[1].modelId_, "NETWORK");
+  ASSERT_EQ(instabilityDetection->getVariables()[1].variableName_, "BUS1_Upu_value");
+  ASSERT_DOUBLE_EQ(instabilityDetection->getVariables()[1].minValue_, 0.5);
+  ASSERT_DOUBLE_EQ(instabilityDetection->getVariables()[1].maxValue_, std::numeric_limits<double>::max());
+  ASSERT_EQ(ct->getTargets().size(), 2);
+  ASSERT_EQ(ct->getTargets()[0].id_, "MyTarget1");
+  ASSERT_EQ(ct->getTargets()[0].dydId_, "MyProtection");
+  ASSERT_EQ(ct->getTargets()[0].parName_, "MyDelay");
+  ASSERT_DOUBLE_EQ(ct->getTargets()[0].minValue_, 0.2);
+  ASSERT_DOUBLE_EQ(ct->getTargets()[0].maxValue_, 0.8);
+  ASSERT_EQ(ct->getTargets()[1].id_, "MyTarget2");
+  ASSERT_TRUE(ct->getTargets()[1].dydId_.empty());
+  ASSERT_EQ(ct->getTargets()[1].parName_, "MyParName2");
+  ASSERT_DOUBLE_EQ(ct->getTargets()[1].minValue_, 0.1);
+  ASSERT_DOUBLE_EQ(ct->getTargets()[1].maxValue_, 1.);
 }
 }  // namespace multipleJobs
@@ -23,14 +23,44 @@
 #include "MacrosMessage.h"
 #include "DYNDynamicData.h"
 #include "DYNModelDescription.h"
+#include "DYNMultiProcessingContext.h"
+#include "DYNInputsHash.h"
 #include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
 
 using DYN::DynamicData;
 using DYN::ModelDescription;
 
 namespace DYNAlgorithms {
+
+const char CriticalTimeCalculation::dydValidationCacheFile_[] = "dydValidation.save.txt";
+
+/**
+ * @brief Compute the path of a file relative to the working directory
+ * @param path absolute path of the file
+ * @param workingDir working directory
+ * @return the path relative to the working directory, the absolute path if the file is outside of it
+ */
+static std::string
+computePathInWorkingDir(const std::string& path, const std::string& workingDir) {
+  std::string::size_type prefixSize = workingDir.size();
+  while (prefixSize > 0 && (workingDir[prefixSize - 1] == '/' || workingDir[prefixSize - 1] == '\\'))
+    --prefixSize;
+  if (path.size() > prefixSize + 1 && path.compare(0, prefixSize, workingDir, 0, prefixSize) == 0
+      && (path[prefixSize] == '/' || path[prefixSize] == '\\'))
+    return path.substr(prefixSize + 1);
+  return path;
+}
+
 CriticalTimeCalculation::CriticalTimeCalculation():
-mode_(SIMPLE) {
+mode_(SIMPLE),
+preFaultTime_(0.),
+faultOnBranching_(false),
+interpolatedSearch_(false),
+priorMargin_(0.) {
 }
 
 void
@@ -113,35 +143,190 @@ CriticalTimeCalculation::getMode() const {
   return mode_;
 }
 
+void
+CriticalTimeCalculation::setPreFaultTime(double preFaultTime) {
+  preFaultTime_ = preFaultTime;
+}
+
+double
+CriticalTimeCalculation::getPreFaultTime() const {
+  return preFaultTime_;
+}
+
+void
+CriticalTimeCalculation::setFaultOnBranching(bool faultOnBranching) {
+  faultOnBranching_ = faultOnBranching;
+}
+
+bool
+CriticalTimeCalculation::getFaultOnBranching() const {
+  return faultOnBranching_;
+}
+
+void
+CriticalTimeCalculation::setInterpolatedSearch(bool interpolatedSearch) {
+  interpolatedSearch_ = interpolatedSearch;
+}
+
+bool
+CriticalTimeCalculation::getInterpolatedSearch() const {
+  return interpolatedSearch_;
+}
+
+void
+CriticalTimeCalculation::setInstabilityDetection(const boost::shared_ptr<InstabilityDetection>& instabilityDetection) {
+  instabilityDetection_ = instabilityDetection;
+}
+
+const boost::shared_ptr<InstabilityDetection>&
+CriticalTimeCalculation::getInstabilityDetection() const {
+  return instabilityDetection_;
+}
+
+void
+CriticalTimeCalculation::setPriorMargin(double priorMargin) {
+  priorMargin_ = priorMargin;
+}
+
+double
+CriticalTimeCalculation::getPriorMargin() const {
+  return priorMargin_;
+}
+
+void
+CriticalTimeCalculation::addTarget(const Target& target) {
+  for (const auto& existingTarget : targets_) {
+    if (existingTarget.id_ == target.id_)
+      throw DYNAlgorithmsError(CriticalTimeTargetIdNotUnique, target.id_);
+  }
+  targets_.push_back(target);
+}
+
+const std::vector<CriticalTimeCalculation::Target>&
+CriticalTimeCalculation::getTargets() const {
+  return targets_;
+}
+
 void
 CriticalTimeCalculation::checkGapBetweenMinValueAndMaxValue() const {
   if (minValue_ > maxValue_ - 2 * accuracy_)
     throw DYNAlgorithmsError(IncoherentMinAndMaxValue, minValue_, maxValue_);
+  for (const auto& target : targets_) {
+    if (target.minValue_ > target.maxValue_ - 2 * accuracy_)
+      throw DYNAlgorithmsError(IncoherentMinAndMaxValue, target.minValue_, target.maxValue_);
+  }
 }
 
 void
 CriticalTimeCalculation::checkDydIdInDydFiles(std::string workingDir) const {
   const std::vector<boost::shared_ptr<Scenario> >& events = scenarios_->getScenarios();
+  // the models of the researched parameters: the dyd id of each target, the one of the scenario for the targets without any
+  std::set<std::string> targetDydIds;
+  bool scenarioDydIdUsed = targets_.empty();
+  for (const auto& target : targets_) {
+    if (target.dydId_.empty())
+      scenarioDydIdUsed = true;
+    else
+      targetDydIds.insert(target.dydId_);
+  }
 
-  std::for_each(events.begin(), events.end(), [this, workingDir](const boost::shared_ptr<Scenario>& scenario) {
-    std::string dydFile = scenario->getDydFile();
-    std::vector<std::string> dydFiles;
-    dydFiles.push_back(createAbsolutePath(dydFile, workingDir));
-    boost::shared_ptr<DYN::DynamicData> dyd(new DYN::DynamicData());
-    dyd->setRootDirectory(workingDir);
-    dyd->initFromDydFiles(dydFiles);
-
-    bool missingDydId = true;
-    std::map<std::string, std::shared_ptr<DYN::ModelDescription>> blackboxes = dyd->getBlackBoxModelDescriptions();
-    for (auto it = blackboxes.begin(); it != blackboxes.end(); ++it) {
-      if (it->first == scenario->getDydId()) {
-        missingDydId = false;
-        break;
+  // the dyd files already validated with the same content are not parsed again:
+  // each line of the cache gives the hash of a dyd file, the dyd id found in it and the path of the file relative to the working directory
+  const std::string cacheFile = createAbsolutePath(dydValidationCacheFile_, workingDir);
+  std::set<std::string> validatedEntries;
+  std::ifstream cache(cacheFile.c_str());
+  std::string line;
+  while (std::getline(cache, line))
+    validatedEntries.insert(line);
+
+  // the validation is distributed among the processes, each dyd file being parsed at most once by each process
+  std::map<std::string, std::set<std::string> > blackBoxIds;  // ids of the black boxes of the dyd files parsed by this process
+  std::set<std::string> currentEntries;  // entries of the dyd files and dyd ids of this calculation validated by this process
+  std::string failedDydId;
+  std::string failedDydFile;
+  std::string parsingError;
+  multiprocessing::forEach(0, events.size(), [&](unsigned int i) {
+    if (!failedDydFile.empty())
+      return;
+    const boost::shared_ptr<Scenario>& scenario = events[i];
+    const std::string dydFile = createAbsolutePath(scenario->getDydFile(), workingDir);
+    InputsHash hash;
+    hash.addFile(dydFile);
+    std::set<std::string> dydIds = targetDydIds;
+    if (scenarioDydIdUsed)
+      dydIds.insert(scenario->getDydId());
+    for (const auto& dydId : dydIds) {
+      const std::string entry = hash.str() + " " + dydId + " " + computePathInWorkingDir(dydFile, workingDir);
+      if (validatedEntries.count(entry) > 0) {
+        currentEntries.insert(entry);
+        continue;
+      }
+      auto found = blackBoxIds.find(dydFile);
+      if (found == blackBoxIds.end()) {
+        std::set<std::string> ids;
+        try {
+          boost::shared_ptr<DynamicData> dyd(new DynamicData());
+          dyd->setRootDirectory(workingDir);
+          dyd->initFromDydFiles(std::vector<std::string>(1, dydFile));
+          for (const auto& blackBox : dyd->getBlackBoxModelDescriptions())
+            ids.insert(blackBox.first);
+        } catch (const std::exception& e) {
+          // reported once all the processes are done, as they all have to fail the same way
+          failedDydFile = scenario->getDydFile();
+          parsingError = e.what();
+          return;
+        }
+        found = blackBoxIds.insert(std::make_pair(dydFile, ids)).first;
+      }
+      if (found->second.count(dydId) == 0) {
+        failedDydId = dydId;
+        failedDydFile = scenario->getDydFile();
+        return;
       }
+      currentEntries.insert(entry);
     }
-    if (missingDydId)
-      throw DYNAlgorithmsError(DydIdNotInDydFile, dydId_, dydFile);
   });
+
+#ifdef _MPI_
+  auto& context = multiprocessing::context();
+  std::string entries;
+  for (const auto& entry : currentEntries)
+    entries += entry + "\n";
+  std::vector<std::string> allEntries;
+  std::vector<std::string> allFailedDydIds;
+  std::vector<std::string> allFailedDydFiles;
+  std::vector<std::string> allParsingErrors;
+  context.gather(entries, allEntries);
+  context.gather(failedDydId, allFailedDydIds);
+  context.gather(failedDydFile, allFailedDydFiles);
+  context.gather(parsingError, allParsingErrors);
+  if (context.isRootProc()) {
+    for (unsigned int i = 0; i < allEntries.size(); ++i) {
+      std::istringstream processEntries(allEntries[i]);
+      while (std::getline(processEntries, line))
+        currentEntries.insert(line);
+      if (failedDydFile.empty() && !allFailedDydFiles[i].empty()) {
+        failedDydId = allFailedDydIds[i];
+        failedDydFile = allFailedDydFiles[i];
+        parsingError = allParsingErrors[i];
+      }
+    }
+  }
+  context.broadcast(failedDydId);
+  context.broadcast(failedDydFile);
+  context.broadcast(parsingError);
+#endif
+
+  // the cache is rewritten with the entries of this calculation only, so that the entries of modified or removed dyd files do not pile up
+  if (multiprocessing::context().isRootProc() && currentEntries != validatedEntries) {
+    std::ofstream cacheOut(cacheFile.c_str(), std::ios::trunc);
+    for (const auto& entry : currentEntries)
+      cacheOut << entry << "\n";
+  }
+  if (!parsingError.empty())
+    throw DYNAlgorithmsError(XmlParsingError, failedDydFile, parsingError);
+  if (!failedDydFile.empty())
+    throw DYNAlgorithmsError(DydIdNotInDydFile, failedDydId, failedDydFile);
 }
 
 void
@@ -22,8 +22,10 @@
 #define COMMON_DYNCRITICALTIMECALCULATION_H_
 
 #include <string>
+#include <vector>
 #include <DYNCommon.h>
 #include "DYNScenarios.h"
+#include "DYNInstabilityDetection.h"
 
 namespace DYNAlgorithms {
 
@@ -42,6 +44,17 @@ class CriticalTimeCalculation{
     COMPLEX = 1,  // Do a dichotomy until it meets a solver issue. it Reduces the range based on previous range and continue the dichotomy
   } mode_t;
 
+  /**
+   * @brief parameter whose critical value is researched for each scenario, in addition to the fault end
+   */
+  struct Target {
+    std::string id_;  ///< id of the target, appended to the id of the scenario in the results
+    std::string dydId_;  ///< id of the model holding the parameter in the dyd files, the dyd id of the scenario if empty
+    std::string parName_;  ///< name of the parameter in the par file
+    double minValue_;  ///< minimum value for the critical value of the parameter
+    double maxValue_;  ///< maximum value for the critical value of the parameter
+  };
+
   /**
    * constructor
    */
@@ -132,12 +145,92 @@ class CriticalTimeCalculation{
   mode_t getMode() const;
 
   /**
-   * @brief Check if the gap between min and max is at least two times the accuracy. Throw an error otherwise
+   * @brief set the time until which the system is simulated once before the critical time research
+   * @param preFaultTime time of the state shared by all the simulations, it must be before the fault inception,
+   * no shared state if not strictly positive
+   */
+  void setPreFaultTime(double preFaultTime);
+
+  /**
+   * @brief get the time until which the system is simulated once before the critical time research
+   * @return time of the state shared by all the simulations, no shared state if not strictly positive
+   */
+  double getPreFaultTime() const;
+
+  /**
+   * @brief set whether the simulations branch from the states of the fault-on trajectory
+   * @param faultOnBranching @b true to simulate the fault-on trajectory once and only the post-clearing part of each iteration
+   */
+  void setFaultOnBranching(bool faultOnBranching);
+
+  /**
+   * @brief get whether the simulations branch from the states of the fault-on trajectory
+   * @return @b true if the fault-on trajectory is simulated once and only the post-clearing part of each iteration
+   */
+  bool getFaultOnBranching() const;
+
+  /**
+   * @brief set whether the clearing time to test is interpolated from the failure times of the previous iterations
+   * @param interpolatedSearch @b true to interpolate the clearing time when possible, @b false for a dichotomy only
+   */
+  void setInterpolatedSearch(bool interpolatedSearch);
+
+  /**
+   * @brief get whether the clearing time to test is interpolated from the failure times of the previous iterations
+   * @return @b true if the clearing time is interpolated when possible
+   */
+  bool getInterpolatedSearch() const;
+
+  /**
+   * @brief set the instability detection used to stop the failing simulations early
+   * @param instabilityDetection instability detection to use, null if not used
+   */
+  void setInstabilityDetection(const boost::shared_ptr<InstabilityDetection>& instabilityDetection);
+
+  /**
+   * @brief get the instability detection used to stop the failing simulations early
+   * @return instability detection to use, null if not used
+   */
+  const boost::shared_ptr<InstabilityDetection>& getInstabilityDetection() const;
+
+  /**
+   * @brief set the half-width of the bracket seeded by the critical time of the leader of a group of scenarios
+   * @param priorMargin half-width (in s) of the seeded bracket, no seeding if not strictly positive
+   */
+  void setPriorMargin(double priorMargin);
+
+  /**
+   * @brief get the half-width of the bracket seeded by the critical time of the leader of a group of scenarios
+   * @return half-width (in s) of the seeded bracket, no seeding if not strictly positive
+   */
+  double getPriorMargin() const;
+
+  /**
+   * @brief add a target parameter: the critical value of each target is researched for each scenario in the same run
+   * @param target target parameter to add
+   */
+  void addTarget(const Target& target);
+
+  /**
+   * @brief get the target parameters
+   * @return target parameters, the critical value of dydId and parName being researched if empty
+   */
+  const std::vector<Target>& getTargets() const;
+
+  /**
+   * @brief Check if the gap between min and max, of the calculation and of each target, is at least two times the accuracy. Throw an error otherwise
    */
   void checkGapBetweenMinValueAndMaxValue() const;
 
   /**
    * @brief Check if the dydId_ is present the dydFile. Throw an error otherwise
+   *
+   * The dyd id of each target is checked in the dyd file of every scenario, and the dyd id of the scenario is only checked
+   * when there is no target or when a target does not give its own dyd id.
+   *
+   * The dyd files are distributed among the processes, and the files validated by a previous calculation with the same content
+   * and dyd id are not parsed again
+   *
    * @param workingDir working directory
    */
   void checkDydIdInDydFiles(std::string workingDir) const;
@@ -157,6 +250,13 @@ class CriticalTimeCalculation{
   double minValue_;  ///< minimum value for the critical time
   double maxValue_;  ///< maximum value for the critical time
   mode_t mode_;   ///< mode for the calculation
+  double preFaultTime_;  ///< time of the state shared by all the simulations, no shared state if not strictly positive
+  bool faultOnBranching_;  ///< whether the simulations branch from the states of the fault-on trajectory
+  bool interpolatedSearch_;  ///< whether the clearing time to test is interpolated from the failure times of the previous iterations
+  double priorMargin_;  ///< half-width of the bracket seeded by the critical time of the leader of a group of scenarios, no seeding if not strictly positive
+  static const char dydValidationCacheFile_[];  ///< name of the file listing the dyd files already validated, in the working directory
+  std::vector<Target> targets_;  ///< target parameters researched for each scenario, dydId and parName being researched if empty
+  boost::shared_ptr<InstabilityDetection> instabilityDetection_;  ///< instability detection to stop the failing simulations early, null if not used
 };
 
 }  // namespace DYNAlgorithms
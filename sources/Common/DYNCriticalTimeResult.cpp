@@ -16,6 +16,12 @@
 
 namespace DYNAlgorithms {
 
+CriticalTimeResult::CriticalTimeResult() :
+criticalTime_(0.),
+status_(EXECUTION_PROBLEM_STATUS),
+instabilityTime_(-1.) {
+}
+
 void
 CriticalTimeResult::setId(const std::string& id) {
   id_ = id;
@@ -61,4 +67,20 @@ CriticalTimeResult::getResult() {
   return result_;
 }
 
+void
+CriticalTimeResult::setInstability(double instabilityTime, const std::string& instabilityReason) {
+  instabilityTime_ = instabilityTime;
+  instabilityReason_ = instabilityReason;
+}
+
+double
+CriticalTimeResult::getInstabilityTime() const {
+  return instabilityTime_;
+}
+
+const std::string&
+CriticalTimeResult::getInstabilityReason() const {
+  return instabilityReason_;
+}
+
 }  // namespace DYNAlgorithms
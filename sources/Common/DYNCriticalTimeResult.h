@@ -30,7 +30,7 @@ class CriticalTimeResult {
    /**
    * @brief constructor
    */
-  CriticalTimeResult() = default;
+  CriticalTimeResult();
 
   /**
    * @brief default destructor
@@ -113,11 +113,32 @@ class CriticalTimeResult {
    */
   SimulationResult& getResult();
 
+  /**
+   * @brief Set the instability detected in the simulation failing at the lowest clearing time
+   * @param instabilityTime time at which the instability was detected
+   * @param instabilityReason description of the monitored variable that left its bounds
+   */
+  void setInstability(double instabilityTime, const std::string& instabilityReason);
+
+  /**
+   * @brief Get the time of the instability detected in the simulation failing at the lowest clearing time
+   * @return time at which the instability was detected, negative if none
+   */
+  double getInstabilityTime() const;
+
+  /**
+   * @brief Get the reason of the instability detected in the simulation failing at the lowest clearing time
+   * @return description of the monitored variable that left its bounds, empty if none
+   */
+  const std::string& getInstabilityReason() const;
+
  private:
   std::string id_;  ///< Scenario Id
   double criticalTime_;  ///< Critical Time Value
   DYNAlgorithms::status_t status_;  ///< Scenario Status
   SimulationResult result_;  ///< Last Simulation Result
+  double instabilityTime_;  ///< time of the instability detected at the lowest failing clearing time, negative if none
+  std::string instabilityReason_;  ///< reason of the instability detected at the lowest failing clearing time
 };
 
 }  // namespace DYNAlgorithms
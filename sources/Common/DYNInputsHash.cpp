@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNInputsHash.cpp
+ *
+ * @brief Hash of the inputs of a calculation : implementation file
+ *
+ */
+
+#include "DYNInputsHash.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace DYNAlgorithms {
+
+InputsHash::InputsHash() :
+hash_(14695981039346656037ULL) {
+}
+
+void
+InputsHash::addFile(const std::string& filePath) {
+  std::ifstream file(filePath.c_str(), std::ios::binary);
+  char buffer[4096];
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+    addBytes(buffer, static_cast<std::size_t>(file.gcount()));
+  addSeparator();
+}
+
+void
+InputsHash::addString(const std::string& value) {
+  addBytes(value.data(), value.size());
+  addSeparator();
+}
+
+std::string
+InputsHash::str() const {
+  std::stringstream ss;
+  ss << std::hex << hash_;
+  return ss.str();
+}
+
+void
+InputsHash::addBytes(const char* data, std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    hash_ ^= static_cast<unsigned char>(data[i]);
+    hash_ *= 1099511628211ULL;
+  }
+}
+
+void
+InputsHash::addSeparator() {
+  // the length of each input would be enough, but the content of a file is read without knowing it
+  static const char separator[] = {'\0', '\x1f'};
+  addBytes(separator, sizeof(separator));
+}
+
+}  // namespace DYNAlgorithms
@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNInputsHash.h
+ *
+ * @brief Hash of the inputs of a calculation : header file
+ *
+ */
+
+#ifndef COMMON_DYNINPUTSHASH_H_
+#define COMMON_DYNINPUTSHASH_H_
+
+#include <cstdint>
+#include <string>
+
+namespace DYNAlgorithms {
+
+/**
+ * @brief InputsHash class
+ *
+ * Hash (64-bit FNV-1a) of the content of input files and values, used to detect the inputs that did not change since
+ * a previous calculation
+ */
+class InputsHash {
+ public:
+  /**
+   * @brief default constructor
+   */
+  InputsHash();
+
+  /**
+   * @brief add the content of a file to the hash
+   * @param filePath path of the file, a missing file being added as an empty one
+   */
+  void addFile(const std::string& filePath);
+
+  /**
+   * @brief add a value to the hash
+   * @param value value to add
+   */
+  void addString(const std::string& value);
+
+  /**
+   * @brief get the hash of the inputs added so far
+   * @return hash of the inputs, as a hexadecimal string
+   */
+  std::string str() const;
+
+ private:
+  /**
+   * @brief add bytes to the hash
+   * @param data bytes to add
+   * @param size number of bytes to add
+   */
+  void addBytes(const char* data, std::size_t size);
+
+  /**
+   * @brief end an input, for the boundaries between the inputs to be part of the hash
+   */
+  void addSeparator();
+
+ private:
+  uint64_t hash_;  ///< current value of the hash
+};
+
+}  // namespace DYNAlgorithms
+
+#endif  // COMMON_DYNINPUTSHASH_H_
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNInstabilityDetection.cpp
+ *
+ * @brief Instability detection description : implementation file
+ *
+ */
+
+#include "DYNInstabilityDetection.h"
+
+namespace DYNAlgorithms {
+
+InstabilityDetection::InstabilityDetection() :
+window_(0.1) {
+}
+
+void
+InstabilityDetection::setWindow(double window) {
+  window_ = window;
+}
+
+double
+InstabilityDetection::getWindow() const {
+  return window_;
+}
+
+void
+InstabilityDetection::addVariable(const std::string& modelId, const std::string& variableName, double minValue, double maxValue) {
+  Variable variable;
+  variable.modelId_ = modelId;
+  variable.variableName_ = variableName;
+  variable.minValue_ = minValue;
+  variable.maxValue_ = maxValue;
+  variables_.push_back(variable);
+}
+
+const std::vector<InstabilityDetection::Variable>&
+InstabilityDetection::getVariables() const {
+  return variables_;
+}
+
+}  // namespace DYNAlgorithms
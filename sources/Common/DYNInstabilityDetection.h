@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNInstabilityDetection.h
+ *
+ * @brief Instability detection description : header file
+ *
+ */
+
+#ifndef COMMON_DYNINSTABILITYDETECTION_H_
+#define COMMON_DYNINSTABILITYDETECTION_H_
+
+#include <vector>
+#include <string>
+
+namespace DYNAlgorithms {
+
+/**
+ * @brief InstabilityDetection class
+ *
+ * Class for the description of the detection of an instability after the last event of a scenario:
+ * the simulation is stopped as soon as a monitored variable leaves its bounds, the scenario being then known to fail
+ */
+class InstabilityDetection {
+ public:
+  /**
+   * @brief variable monitored by the instability detection
+   */
+  struct Variable {
+    std::string modelId_;  ///< id of the model of the variable
+    std::string variableName_;  ///< name of the variable in the model
+    double minValue_;  ///< lowest value of the variable in a stable trajectory
+    double maxValue_;  ///< highest value of the variable in a stable trajectory
+  };
+
+  /**
+   * @brief default constructor
+   */
+  InstabilityDetection();
+
+  /**
+   * @brief set the duration between two checks of the monitored variables
+   * @param window duration (in s) between two checks of the monitored variables
+   */
+  void setWindow(double window);
+
+  /**
+   * @brief get the duration between two checks of the monitored variables
+   * @return duration (in s) between two checks of the monitored variables
+   */
+  double getWindow() const;
+
+  /**
+   * @brief add a variable to monitor
+   * @param modelId id of the model of the variable
+   * @param variableName name of the variable in the model
+   * @param minValue lowest value of the variable in a stable trajectory
+   * @param maxValue highest value of the variable in a stable trajectory
+   */
+  void addVariable(const std::string& modelId, const std::string& variableName, double minValue, double maxValue);
+
+  /**
+   * @brief get the variables to monitor
+   * @return variables to monitor
+   */
+  const std::vector<Variable>& getVariables() const;
+
+ private:
+  double window_;  ///< duration (in s) between two checks of the monitored variables
+  std::vector<Variable> variables_;  ///< variables to monitor
+};
+
+}  // namespace DYNAlgorithms
+
+#endif  // COMMON_DYNINSTABILITYDETECTION_H_
@@ -15,7 +15,9 @@
 
 namespace DYNAlgorithms {
 
-LoadIncreaseResult::LoadIncreaseResult(const size_t nbScenarios) {
+LoadIncreaseResult::LoadIncreaseResult(const size_t nbScenarios) :
+screening_(false),
+decided_(false) {
     scenariosResults_.resize(nbScenarios);
 }
 
@@ -23,4 +25,9 @@ SimulationResult&
 LoadIncreaseResult::getScenarioResult(size_t idx) {
   return scenariosResults_.at(idx);
 }
+
+void
+LoadIncreaseResult::addScenarioResult(const SimulationResult& result) {
+  scenariosResults_.push_back(result);
+}
 }  // namespace DYNAlgorithms
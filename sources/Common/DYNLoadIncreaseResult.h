@@ -14,6 +14,7 @@
 #ifndef COMMON_DYNLOADINCREASERESULT_H_
 #define COMMON_DYNLOADINCREASERESULT_H_
 
+#include <string>
 #include <vector>
 #include "DYNSimulationResult.h"
 #include "DYNResultCommon.h"
@@ -58,6 +59,54 @@ class LoadIncreaseResult {
     result_ = result;
   }
 
+  /**
+   * @brief get the id of the load increase of this result
+   * @return id of the load increase, empty if the margin calculation has only one load increase
+   */
+  const std::string& getLoadIncreaseId() const {
+    return loadIncreaseId_;
+  }
+
+  /**
+   * @brief set the id of the load increase of this result
+   * @param loadIncreaseId id of the load increase
+   */
+  void setLoadIncreaseId(const std::string& loadIncreaseId) {
+    loadIncreaseId_ = loadIncreaseId;
+  }
+
+  /**
+   * @brief check whether the scenarios results come from the screening research
+   * @return @b true if the scenarios were simulated with the shortened duration of the screening research
+   */
+  bool isScreening() const {
+    return screening_;
+  }
+
+  /**
+   * @brief set whether the scenarios results come from the screening research
+   * @param screening @b true if the scenarios were simulated with the shortened duration of the screening research
+   */
+  void setScreening(bool screening) {
+    screening_ = screening;
+  }
+
+  /**
+   * @brief check whether the load increase of this level was simulated
+   * @return @b true if the load increase was not simulated, the scenarios results being deduced from their known bounds
+   */
+  bool isDecided() const {
+    return decided_;
+  }
+
+  /**
+   * @brief set whether the load increase of this level was simulated
+   * @param decided @b true if the load increase was not simulated, the scenarios results being deduced from their known bounds
+   */
+  void setDecided(bool decided) {
+    decided_ = decided;
+  }
+
   /**
    * @brief result getter
    * @param idx id of the result
@@ -65,6 +114,12 @@ class LoadIncreaseResult {
    */
   SimulationResult& getScenarioResult(size_t idx);
 
+  /**
+   * @brief add a scenario result at the end of the scenarios results
+   * @param result scenario result to add
+   */
+  void addScenarioResult(const SimulationResult& result);
+
   /**
    * @brief getter for the scenarios results
    * @return scenarios results associated to this load increase
@@ -74,6 +129,9 @@ class LoadIncreaseResult {
   }
 
  private:
+  std::string loadIncreaseId_;  ///< id of the load increase, empty if the margin calculation has only one load increase
+  bool screening_;  ///< whether the scenarios results come from the screening research
+  bool decided_;  ///< whether the load increase was not simulated, the scenarios results being deduced from their known bounds
   SimulationResult result_;  ///< load increase result
   std::vector<SimulationResult> scenariosResults_;  ///< list of scenarios results
 };
@@ -23,17 +23,31 @@
 namespace DYNAlgorithms {
 MarginCalculation::MarginCalculation():
 calculationType_(GLOBAL_MARGIN),
-accuracy_(5.) {
+accuracy_(5.),
+archiveLoadIncreaseStates_(false),
+screeningDuration_(0.),
+levelSelection_(BISECTION) {
 }
 
 void
-MarginCalculation::setLoadIncrease(const boost::shared_ptr<LoadIncrease>& loadIncrease) {
-  loadIncrease_ = loadIncrease;
+MarginCalculation::addLoadIncrease(const boost::shared_ptr<LoadIncrease>& loadIncrease) {
+  for (const auto& existingLoadIncrease : loadIncreases_) {
+    if (existingLoadIncrease->getId() == loadIncrease->getId())
+      throw DYNAlgorithmsError(LoadIncreaseIdNotUnique, loadIncrease->getId());
+  }
+  loadIncreases_.push_back(loadIncrease);
 }
 
 boost::shared_ptr<LoadIncrease>
 MarginCalculation::getLoadIncrease() const {
-  return loadIncrease_;
+  if (loadIncreases_.empty())
+    return boost::shared_ptr<LoadIncrease>();
+  return loadIncreases_.front();
+}
+
+const std::vector<boost::shared_ptr<LoadIncrease> >&
+MarginCalculation::getLoadIncreases() const {
+  return loadIncreases_;
 }
 
 void
@@ -58,6 +72,46 @@ MarginCalculation::getAccuracy() const {
   return accuracy_;
 }
 
+void
+MarginCalculation::setPreviousResultsFile(const std::string& previousResultsFile) {
+  previousResultsFile_ = previousResultsFile;
+}
+
+const std::string&
+MarginCalculation::getPreviousResultsFile() const {
+  return previousResultsFile_;
+}
+
+void
+MarginCalculation::setArchiveLoadIncreaseStates(bool archiveLoadIncreaseStates) {
+  archiveLoadIncreaseStates_ = archiveLoadIncreaseStates;
+}
+
+bool
+MarginCalculation::getArchiveLoadIncreaseStates() const {
+  return archiveLoadIncreaseStates_;
+}
+
+void
+MarginCalculation::setScreeningDuration(double screeningDuration) {
+  screeningDuration_ = screeningDuration;
+}
+
+double
+MarginCalculation::getScreeningDuration() const {
+  return screeningDuration_;
+}
+
+void
+MarginCalculation::setLevelSelection(levelSelection_t levelSelection) {
+  levelSelection_ = levelSelection;
+}
+
+MarginCalculation::levelSelection_t
+MarginCalculation::getLevelSelection() const {
+  return levelSelection_;
+}
+
 void
 MarginCalculation::setCalculationType(calculationType_t calculationType) {
   calculationType_ = calculationType;
@@ -45,16 +45,27 @@ class MarginCalculation {
     LOCAL_MARGIN
   } calculationType_t;
 
+  /**
+   * selection of the variation simulated for a bracket of the local margin research
+   */
+  typedef enum {
+    BISECTION = 0,
+    ACTIVE_LEARNING
+  } levelSelection_t;
+
   /**
    * constructor
    */
   MarginCalculation();
 
   /**
-   * @brief set the load increase event to the margin calculation
+   * @brief add a load increase event to the margin calculation
+   *
+   * Each load increase is a direction of increase of the load for which a margin is computed
+   *
    * @param loadIncrease load increase event
    */
-  void setLoadIncrease(const boost::shared_ptr<LoadIncrease>& loadIncrease);
+  void addLoadIncrease(const boost::shared_ptr<LoadIncrease>& loadIncrease);
 
   /**
    * @brief set the scenarios of the margin calculation
@@ -87,11 +98,66 @@ class MarginCalculation {
   int getAccuracy() const;
 
   /**
-   * @brief get the load increase event associated to the margin calculation
-   * @return load increase event associated to the margin calculation
+   * @brief set the aggregated results of a previous margin calculation used to warm-start the research
+   * @param previousResultsFile aggregated results file of a previous run
+   */
+  void setPreviousResultsFile(const std::string& previousResultsFile);
+
+  /**
+   * @brief get the aggregated results of a previous margin calculation used to warm-start the research
+   * @return aggregated results file of a previous run, empty if none
+   */
+  const std::string& getPreviousResultsFile() const;
+
+  /**
+   * @brief set whether the load increase final states are archived before being removed from the working directory
+   * @param archiveLoadIncreaseStates @b true to keep a compressed copy of the final states no longer needed by the research
+   */
+  void setArchiveLoadIncreaseStates(bool archiveLoadIncreaseStates);
+
+  /**
+   * @brief get whether the load increase final states are archived before being removed from the working directory
+   * @return @b true if a compressed copy of the final states no longer needed by the research is kept
+   */
+  bool getArchiveLoadIncreaseStates() const;
+
+  /**
+   * @brief set the duration of the scenarios simulations of the screening research
+   * @param screeningDuration duration of the scenarios simulations used to bracket the margins before the full duration research,
+   * no screening if not strictly positive
+   */
+  void setScreeningDuration(double screeningDuration);
+
+  /**
+   * @brief get the duration of the scenarios simulations of the screening research
+   * @return duration of the scenarios simulations of the screening research, no screening if not strictly positive
+   */
+  double getScreeningDuration() const;
+
+  /**
+   * @brief set the selection of the variation simulated for a bracket of the local margin research
+   * @param levelSelection selection of the variation, could be either @b BISECTION or @b ACTIVE_LEARNING
+   */
+  void setLevelSelection(levelSelection_t levelSelection);
+
+  /**
+   * @brief get the selection of the variation simulated for a bracket of the local margin research
+   * @return selection of the variation
+   */
+  levelSelection_t getLevelSelection() const;
+
+  /**
+   * @brief get the first load increase event associated to the margin calculation
+   * @return first load increase event associated to the margin calculation, null if none
    */
   boost::shared_ptr<LoadIncrease> getLoadIncrease() const;
 
+  /**
+   * @brief get the load increase events associated to the margin calculation
+   * @return load increase events associated to the margin calculation
+   */
+  const std::vector<boost::shared_ptr<LoadIncrease> >& getLoadIncreases() const;
+
   /**
    * @brief get the scenarios associated to the margin calculation
    * @return scenarios associated to the margin calculation
@@ -100,9 +166,13 @@ class MarginCalculation {
 
  private:
   boost::shared_ptr<Scenarios> scenarios_;  ///< description of the scenarios to apply after the load increase
-  boost::shared_ptr<LoadIncrease> loadIncrease_;  ///< description of the load increase event to apply to the original situation
+  std::vector<boost::shared_ptr<LoadIncrease> > loadIncreases_;  ///< description of the load increase events to apply to the original situation
   calculationType_t calculationType_;  ///< type of the algorithm, could be either @b GLOBAL_MARGIN or @b LOCAL_MARGIN
   double accuracy_;  ///< accuracy of the algorithm
+  std::string previousResultsFile_;  ///< aggregated results of a previous run used to warm-start the research
+  bool archiveLoadIncreaseStates_;  ///< whether the load increase final states are zipped before being removed
+  double screeningDuration_;  ///< duration of the scenarios simulations of the screening research, no screening if not strictly positive
+  levelSelection_t levelSelection_;  ///< selection of the variation simulated for a bracket, could be either @b BISECTION or @b ACTIVE_LEARNING
 };
 
 }  // namespace DYNAlgorithms
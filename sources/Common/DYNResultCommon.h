@@ -50,6 +50,22 @@ static inline std::string getStatusAsString(status_t status) {
   return "";  // to avoid compiler warning, should not appear
 }
 
+/**
+ * @brief get the status corresponding to its string representation
+ * @param str string representation of the status
+ * @param status status corresponding to the string
+ * @return true if the string is the representation of a status, false otherwise
+ */
+static inline bool getStatusFromString(const std::string& str, status_t& status) {
+  for (int i = CONVERGENCE_STATUS; i <= CT_ABOVE_MAX_BOUND_STATUS; ++i) {
+    if (getStatusAsString(static_cast<status_t>(i)) == str) {
+      status = static_cast<status_t>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace DYNAlgorithms
 #endif  // COMMON_DYNRESULTCOMMON_H_
 
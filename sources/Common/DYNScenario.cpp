@@ -61,4 +61,24 @@ Scenario::getCriteriaFile() const {
   return criteriaFile_;
 }
 
+void
+Scenario::setGroup(const std::string& group) {
+  group_ = group;
+}
+
+const std::string&
+Scenario::getGroup() const {
+  return group_;
+}
+
+void
+Scenario::addEvent(const Event& event) {
+  events_.push_back(event);
+}
+
+const std::vector<Scenario::Event>&
+Scenario::getEvents() const {
+  return events_;
+}
+
 }  // namespace DYNAlgorithms
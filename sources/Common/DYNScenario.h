@@ -22,6 +22,7 @@
 #define COMMON_DYNSCENARIO_H_
 
 #include <string>
+#include <vector>
 
 namespace DYNAlgorithms {
 /**
@@ -30,6 +31,40 @@ namespace DYNAlgorithms {
  */
 class Scenario {
  public:
+  /**
+   * @brief Event of a contingency given in the multiple jobs file instead of a dyd file
+   */
+  struct Event {
+    /**
+     * Type of event
+     */
+    typedef enum {
+      BRANCH_DISCONNECTION = 0,  // Disconnection of both sides of a line or a transformer
+      INJECTION_DISCONNECTION = 1,  // Disconnection of a generator, a load or a shunt
+    } type_t;
+
+    /**
+     * @brief Parameter of the event model
+     */
+    struct Parameter {
+      std::string name_;  ///< name of the parameter
+      std::string type_;  ///< type of the parameter in the par file (DOUBLE, INT, BOOL or STRING)
+      std::string value_;  ///< value of the parameter
+    };
+
+    /**
+     * @brief default constructor
+     */
+    Event() : type_(BRANCH_DISCONNECTION), time_(0.) {}
+
+    std::string elementId_;  ///< id of the network element affected by the event
+    std::string modelId_;  ///< id of the model the event is connected to, the network model if empty
+    std::string variable_;  ///< variable of this model the event is connected to, the state of the element in the network model if empty
+    type_t type_;  ///< type of event
+    double time_;  ///< time of the event
+    std::vector<Parameter> parameters_;  ///< parameters of the event model, in addition to or instead of the default ones
+  };
+
   /**
    * @brief set the id of the scenario
    * @param id id of the scenario
@@ -54,6 +89,12 @@ class Scenario {
    */
   void setCriteriaFile(const std::string& file);
 
+  /**
+   * @brief set the group of scenarios with close critical times the scenario belongs to
+   * @param group group of the scenario
+   */
+  void setGroup(const std::string& group);
+
   /**
    * @brief get the id of the scenario
    * @return id of the scenario
@@ -78,11 +119,29 @@ class Scenario {
    */
   const std::string& getCriteriaFile() const;
 
+  /**
+   * @brief get the group of scenarios with close critical times the scenario belongs to
+   * @return group of the scenario, empty if not declared
+   */
+  const std::string& getGroup() const;
+  /**
+   * @brief add an event to the contingency of the scenario
+   * @param event event to add
+   */
+  void addEvent(const Event& event);
+  /**
+   * @brief get the events of the contingency of the scenario given in the multiple jobs file
+   * @return events of the scenario, in addition to the ones of its dyd file
+   */
+  const std::vector<Event>& getEvents() const;
+
  private:
   std::string id_;  ///< id of the scenario
   std::string dydFile_;  ///< dyd file to use for the scenario
   std::string dydId_;  ///< dyd id to use for the scenario
   std::string criteriaFile_;  ///< criteria file to use for the scenario
+  std::string group_;  ///< group of scenarios with close critical times the scenario belongs to
+  std::vector<Event> events_;  ///< events of the contingency given in the multiple jobs file
 };
 
 }  // namespace DYNAlgorithms
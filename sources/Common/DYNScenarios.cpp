@@ -22,6 +22,12 @@
 
 namespace DYNAlgorithms {
 
+Scenarios::Scenarios() :
+initialization_(INIT_EACH_SCENARIO),
+screeningDuration_(0.),
+outputsRetention_(OUTPUTS_ALL) {
+}
+
 void
 Scenarios::addScenario(const boost::shared_ptr<Scenario>& scenario) {
   scenarios_.push_back(scenario);
@@ -42,4 +48,68 @@ Scenarios::setJobsFile(const std::string& jobsFile) {
   jobsFile_ = jobsFile;
 }
 
+const boost::shared_ptr<SteadyStateDetection>&
+Scenarios::getSteadyStateDetection() const {
+  return steadyStateDetection_;
+}
+
+void
+Scenarios::setSteadyStateDetection(const boost::shared_ptr<SteadyStateDetection>& steadyStateDetection) {
+  steadyStateDetection_ = steadyStateDetection;
+}
+
+Scenarios::initialization_t
+Scenarios::getInitialization() const {
+  return initialization_;
+}
+
+void
+Scenarios::setInitialization(initialization_t initialization) {
+  initialization_ = initialization;
+}
+
+const std::string&
+Scenarios::getResultsCacheDirectory() const {
+  return resultsCacheDirectory_;
+}
+
+void
+Scenarios::setResultsCacheDirectory(const std::string& resultsCacheDirectory) {
+  resultsCacheDirectory_ = resultsCacheDirectory;
+}
+
+double
+Scenarios::getScreeningDuration() const {
+  return screeningDuration_;
+}
+
+void
+Scenarios::setScreeningDuration(double screeningDuration) {
+  screeningDuration_ = screeningDuration;
+}
+
+Scenarios::outputsRetention_t
+Scenarios::getOutputsRetention() const {
+  return outputsRetention_;
+}
+
+void
+Scenarios::setOutputsRetention(outputsRetention_t outputsRetention) {
+  outputsRetention_ = outputsRetention;
+}
+
+bool
+Scenarios::keepsOutputs(status_t status) const {
+  switch (outputsRetention_) {
+    case OUTPUTS_NON_CONVERGENCE:
+      // a critical time found is the converging outcome of a critical time calculation
+      return status != CONVERGENCE_STATUS && status != RESULT_FOUND_STATUS;
+    case OUTPUTS_CRITERIA_NON_RESPECTED:
+      return status == CRITERIA_NON_RESPECTED_STATUS;
+    case OUTPUTS_ALL:
+      return true;
+  }
+  return true;
+}
+
 }  // namespace DYNAlgorithms
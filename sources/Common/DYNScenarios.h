@@ -25,6 +25,8 @@
 #include <string>
 #include <boost/shared_ptr.hpp>
 #include "DYNScenario.h"
+#include "DYNSteadyStateDetection.h"
+#include "DYNResultCommon.h"
 
 namespace DYNAlgorithms {
 
@@ -35,6 +37,29 @@ namespace DYNAlgorithms {
  */
 class Scenarios {
  public:
+  /**
+   * Initialization of the scenarios simulations
+   */
+  typedef enum {
+    INIT_EACH_SCENARIO = 0,  // Each scenario simulation computes its own initial state
+    INIT_SHARED = 1,  // The initial state is computed once by the root process and shared with all the processes
+    INIT_SHARED_PER_PROCESS = 2,  // The initial state is computed once by each process and shared with its scenarios
+  } initialization_t;
+
+  /**
+   * Retention of the outputs of the scenarios simulations
+   */
+  typedef enum {
+    OUTPUTS_ALL = 0,  // The outputs of all the scenarios are kept
+    OUTPUTS_NON_CONVERGENCE = 1,  // The outputs are only kept for the scenarios not converging
+    OUTPUTS_CRITERIA_NON_RESPECTED = 2,  // The outputs are only kept for the scenarios with failing criteria
+  } outputsRetention_t;
+
+  /**
+   * @brief default constructor
+   */
+  Scenarios();
+
   /**
    * @brief add a scenario to the list
    * @param scenario scenario to add
@@ -65,9 +90,87 @@ class Scenarios {
    */
   void setJobsFile(const std::string& jobsFile);
 
+  /**
+   * @brief get the steady state detection to use to end the scenarios simulations early
+   * @return steady state detection to use, null if the scenarios are simulated until their stop time
+   */
+  const boost::shared_ptr<SteadyStateDetection>& getSteadyStateDetection() const;
+
+  /**
+   * @brief set the steady state detection to use to end the scenarios simulations early
+   * @param steadyStateDetection steady state detection to use
+   */
+  void setSteadyStateDetection(const boost::shared_ptr<SteadyStateDetection>& steadyStateDetection);
+
+  /**
+   * @brief get the initialization of the scenarios simulations
+   * @return initialization of the scenarios simulations
+   */
+  initialization_t getInitialization() const;
+
+  /**
+   * @brief set the initialization of the scenarios simulations
+   * @param initialization initialization of the scenarios simulations
+   */
+  void setInitialization(initialization_t initialization);
+
+  /**
+   * @brief get the directory where the results of the scenarios are kept to be reused by the next calculations
+   * @return directory of the results cache, empty if the results are not cached
+   */
+  const std::string& getResultsCacheDirectory() const;
+
+  /**
+   * @brief set the directory where the results of the scenarios are kept to be reused by the next calculations
+   * @param resultsCacheDirectory directory of the results cache, relative to the working directory
+   */
+  void setResultsCacheDirectory(const std::string& resultsCacheDirectory);
+
+  /**
+   * @brief get the simulated duration of the screening pass of the scenarios
+   * @return simulated duration of the screening pass, no screening pass if not strictly positive
+   */
+  double getScreeningDuration() const;
+
+  /**
+   * @brief set the simulated duration of the screening pass of the scenarios
+   *
+   * All the scenarios are first simulated on this duration, only the ones not converging being then simulated until their stop time
+   *
+   * @param screeningDuration simulated duration of the screening pass
+   */
+  void setScreeningDuration(double screeningDuration);
+
+  /**
+   * @brief get the retention of the outputs of the scenarios simulations
+   * @return retention of the outputs of the scenarios simulations
+   */
+  outputsRetention_t getOutputsRetention() const;
+
+  /**
+   * @brief set the retention of the outputs of the scenarios simulations
+   * @param outputsRetention retention of the outputs of the scenarios simulations
+   */
+  void setOutputsRetention(outputsRetention_t outputsRetention);
+
+  /**
+   * @brief whether the outputs of a scenario simulation are kept according to the retention of the outputs
+   *
+   * For a critical time calculation, the status is the final one of the calculation, a critical time found being its convergence
+   *
+   * @param status status of the scenario simulation
+   * @return true if the timeline, constraints, lost equipments and final state of the simulation are kept, false if they are discarded
+   */
+  bool keepsOutputs(status_t status) const;
+
  private:
   std::vector<boost::shared_ptr<Scenario> > scenarios_;  ///< list of scenarios to launch
   std::string jobsFile_;  ///< jobs file used as base for the scenarios
+  boost::shared_ptr<SteadyStateDetection> steadyStateDetection_;  ///< steady state detection to end the simulations early, null if not used
+  initialization_t initialization_;  ///< initialization of the scenarios simulations
+  std::string resultsCacheDirectory_;  ///< directory of the results cache, empty if the results are not cached
+  double screeningDuration_;  ///< simulated duration of the screening pass, no screening pass if not strictly positive
+  outputsRetention_t outputsRetention_;  ///< retention of the outputs of the scenarios simulations
 };
 
 }  // namespace DYNAlgorithms
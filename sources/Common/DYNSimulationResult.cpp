@@ -29,7 +29,10 @@ SimulationResult::SimulationResult():
     status_(EXECUTION_PROBLEM_STATUS),
     timelineFileExtension_("xml"),
     constraintsFileExtension_("xml"),
-    lostEquipmentsFileExtension_("xml") {
+    lostEquipmentsFileExtension_("xml"),
+    steadyStateTime_(-1.),
+    instabilityTime_(-1.),
+    screening_(false) {
 }
 
 SimulationResult::SimulationResult(const SimulationResult& result):
@@ -41,7 +44,11 @@ SimulationResult::SimulationResult(const SimulationResult& result):
     timelineFileExtension_(result.timelineFileExtension_),
     constraintsFileExtension_(result.constraintsFileExtension_),
     lostEquipmentsFileExtension_(result.lostEquipmentsFileExtension_),
-    logPath_(result.logPath_) {
+    logPath_(result.logPath_),
+    steadyStateTime_(result.steadyStateTime_),
+    instabilityTime_(result.instabilityTime_),
+    instabilityReason_(result.instabilityReason_),
+    screening_(result.screening_) {
   timelineStream_ << result.timelineStream_.str();
   constraintsStream_ << result.constraintsStream_.str();
   lostEquipmentsStream_ << result.lostEquipmentsStream_.str();
@@ -72,6 +79,10 @@ SimulationResult::operator=(const SimulationResult& result) {
   constraintsFileExtension_ =  result.constraintsFileExtension_;
   lostEquipmentsFileExtension_ = result.lostEquipmentsFileExtension_;
   logPath_ = result.logPath_;
+  steadyStateTime_ = result.steadyStateTime_;
+  instabilityTime_ = result.instabilityTime_;
+  instabilityReason_ = result.instabilityReason_;
+  screening_ = result.screening_;
   simulationMessageError_ = result.simulationMessageError_;
   return *this;
 }
@@ -147,6 +158,18 @@ SimulationResult::getOutputIIDMStreamStr() const {
   return outputIIDMStream_.str();
 }
 
+void
+SimulationResult::clearOutputs() {
+  timelineStream_.str("");
+  timelineStream_.clear();
+  constraintsStream_.str("");
+  constraintsStream_.clear();
+  lostEquipmentsStream_.str("");
+  lostEquipmentsStream_.clear();
+  outputIIDMStream_.str("");
+  outputIIDMStream_.clear();
+}
+
 std::string
 SimulationResult::getScenarioId() const {
   return scenarioId_;
@@ -256,4 +279,50 @@ void
 SimulationResult::setLogPath(const std::string& logPath) {
   logPath_ = logPath;
 }
+
+double
+SimulationResult::getSteadyStateTime() const {
+  return steadyStateTime_;
+}
+
+void
+SimulationResult::setSteadyStateTime(double steadyStateTime) {
+  steadyStateTime_ = steadyStateTime;
+}
+
+bool
+SimulationResult::isStoppedOnSteadyState() const {
+  return steadyStateTime_ >= 0.;
+}
+
+double
+SimulationResult::getInstabilityTime() const {
+  return instabilityTime_;
+}
+
+const std::string&
+SimulationResult::getInstabilityReason() const {
+  return instabilityReason_;
+}
+
+void
+SimulationResult::setInstability(double instabilityTime, const std::string& instabilityReason) {
+  instabilityTime_ = instabilityTime;
+  instabilityReason_ = instabilityReason;
+}
+
+bool
+SimulationResult::isStoppedOnInstability() const {
+  return instabilityTime_ >= 0.;
+}
+
+bool
+SimulationResult::isScreening() const {
+  return screening_;
+}
+
+void
+SimulationResult::setScreening(bool screening) {
+  screening_ = screening;
+}
 }  // namespace DYNAlgorithms
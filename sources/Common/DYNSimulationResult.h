@@ -156,6 +156,11 @@ class SimulationResult {
    */
   std::string getOutputIIDMStreamStr() const;
 
+  /**
+   * @brief clear the timeline, constraints, lost equipments and final state IIDM associated to the scenario
+   */
+  void clearOutputs();
+
   /**
    * @brief getter of the scenario id associated to the simulation
    * @return the scenario id associated to the simulation
@@ -273,6 +278,61 @@ class SimulationResult {
    */
   void setLogPath(const std::string& logPath);
 
+  /**
+   * @brief getter of the time at which the simulation was stopped on steady state
+   * @return time at which the simulation was stopped on steady state, negative if it ran until its stop time
+   */
+  double getSteadyStateTime() const;
+
+  /**
+   * @brief setter of the time at which the simulation was stopped on steady state
+   * @param steadyStateTime time at which the simulation was stopped on steady state
+   */
+  void setSteadyStateTime(double steadyStateTime);
+
+  /**
+   * @brief indicates whether the simulation was stopped before its stop time as a steady state was reached
+   * @return @b true if the simulation was stopped on steady state, @b false otherwise
+   */
+  bool isStoppedOnSteadyState() const;
+
+  /**
+   * @brief getter of the time at which the simulation was stopped on instability
+   * @return time at which the simulation was stopped on instability, negative if no instability was detected
+   */
+  double getInstabilityTime() const;
+
+  /**
+   * @brief getter of the reason for which the simulation was stopped on instability
+   * @return description of the monitored variable that left its bounds, empty if no instability was detected
+   */
+  const std::string& getInstabilityReason() const;
+
+  /**
+   * @brief setter of the instability on which the simulation was stopped
+   * @param instabilityTime time at which the simulation was stopped on instability
+   * @param instabilityReason description of the monitored variable that left its bounds
+   */
+  void setInstability(double instabilityTime, const std::string& instabilityReason);
+
+  /**
+   * @brief indicates whether the simulation was stopped before its stop time as an instability was detected
+   * @return @b true if the simulation was stopped on instability, @b false otherwise
+   */
+  bool isStoppedOnInstability() const;
+
+  /**
+   * @brief indicates whether the simulation was run with the shortened duration of the screening pass
+   * @return @b true if the result comes from the screening pass, @b false otherwise
+   */
+  bool isScreening() const;
+
+  /**
+   * @brief setter of whether the simulation was run with the shortened duration of the screening pass
+   * @param screening @b true if the result comes from the screening pass
+   */
+  void setScreening(bool screening);
+
  private:
   std::stringstream timelineStream_;  ///< stream for the timeline associated to the scenario
   std::stringstream constraintsStream_;  ///< stream for the constraints associated to the scenario
@@ -287,6 +347,10 @@ class SimulationResult {
   std::string constraintsFileExtension_;  ///< constraints export mode for this result
   std::string lostEquipmentsFileExtension_;  ///< lost equipments export mode for this result
   std::string logPath_;   ///< Path to the general dynawo log file associated to this result
+  double steadyStateTime_;  ///< time at which the simulation was stopped on steady state, negative if it ran until its stop time
+  double instabilityTime_;  ///< time at which the simulation was stopped on instability, negative if no instability was detected
+  std::string instabilityReason_;  ///< description of the monitored variable that left its bounds
+  bool screening_;  ///< whether the simulation was run with the shortened duration of the screening pass
   std::string simulationMessageError_;  ///< message of the last simulation failed.
 };
 
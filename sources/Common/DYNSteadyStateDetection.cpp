@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNSteadyStateDetection.cpp
+ *
+ * @brief Steady state detection description : implementation file
+ *
+ */
+
+#include "DYNSteadyStateDetection.h"
+
+namespace DYNAlgorithms {
+
+SteadyStateDetection::SteadyStateDetection() :
+window_(10.),
+threshold_(1e-4) {
+}
+
+void
+SteadyStateDetection::setWindow(double window) {
+  window_ = window;
+}
+
+double
+SteadyStateDetection::getWindow() const {
+  return window_;
+}
+
+void
+SteadyStateDetection::setThreshold(double threshold) {
+  threshold_ = threshold;
+}
+
+double
+SteadyStateDetection::getThreshold() const {
+  return threshold_;
+}
+
+void
+SteadyStateDetection::addVariable(const std::string& modelId, const std::string& variableName) {
+  variables_.emplace_back(modelId, variableName);
+}
+
+const std::vector<std::pair<std::string, std::string> >&
+SteadyStateDetection::getVariables() const {
+  return variables_;
+}
+
+}  // namespace DYNAlgorithms
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+/**
+ * @file  DYNSteadyStateDetection.h
+ *
+ * @brief Steady state detection description : header file
+ *
+ */
+
+#ifndef COMMON_DYNSTEADYSTATEDETECTION_H_
+#define COMMON_DYNSTEADYSTATEDETECTION_H_
+
+#include <vector>
+#include <string>
+#include <utility>
+
+namespace DYNAlgorithms {
+
+/**
+ * @brief SteadyStateDetection class
+ *
+ * Class for the description of the detection of a steady state after the last event of a scenario:
+ * the simulation is stopped as soon as each monitored variable varies less than a threshold over a window
+ */
+class SteadyStateDetection {
+ public:
+  /**
+   * @brief default constructor
+   */
+  SteadyStateDetection();
+
+  /**
+   * @brief set the duration over which the monitored variables are compared
+   * @param window duration (in s) over which the monitored variables are compared
+   */
+  void setWindow(double window);
+
+  /**
+   * @brief get the duration over which the monitored variables are compared
+   * @return duration (in s) over which the monitored variables are compared
+   */
+  double getWindow() const;
+
+  /**
+   * @brief set the maximum variation of a monitored variable over the window at steady state
+   * @param threshold maximum variation of a monitored variable over the window at steady state
+   */
+  void setThreshold(double threshold);
+
+  /**
+   * @brief get the maximum variation of a monitored variable over the window at steady state
+   * @return maximum variation of a monitored variable over the window at steady state
+   */
+  double getThreshold() const;
+
+  /**
+   * @brief add a variable to monitor
+   * @param modelId id of the model of the variable
+   * @param variableName name of the variable in the model
+   */
+  void addVariable(const std::string& modelId, const std::string& variableName);
+
+  /**
+   * @brief get the variables to monitor
+   * @return variables to monitor, as pairs (model id, variable name)
+   */
+  const std::vector<std::pair<std::string, std::string> >& getVariables() const;
+
+ private:
+  double window_;  ///< duration (in s) over which the monitored variables are compared
+  double threshold_;  ///< maximum variation of a monitored variable over the window at steady state
+  std::vector<std::pair<std::string, std::string> > variables_;  ///< variables to monitor (model id, variable name)
+};
+
+}  // namespace DYNAlgorithms
+
+#endif  // COMMON_DYNSTEADYSTATEDETECTION_H_
@@ -16,6 +16,7 @@
 #include "DYNCommon.h"
 #include "DYNScenario.h"
 #include "DYNScenarios.h"
+#include "DYNInputsHash.h"
 #include "DYNMarginCalculation.h"
 #include "DYNCriticalTimeCalculation.h"
 #include "DYNSimulationResult.h"
@@ -31,20 +32,74 @@ TEST(TestBaseClasses, testScenario) {
   ASSERT_EQ(t.getDydFile(), "");
   ASSERT_EQ(t.getDydId(), "");
   ASSERT_EQ(t.getCriteriaFile(), "");
+  ASSERT_EQ(t.getGroup(), "");
   t.setId("MyId");
   t.setDydFile("MyDydFile");
   t.setDydId("MyDydId");
   t.setCriteriaFile("MyCrtFile");
+  t.setGroup("MyGroup");
   ASSERT_EQ(t.getId(), "MyId");
   ASSERT_EQ(t.getDydFile(), "MyDydFile");
   ASSERT_EQ(t.getDydId(), "MyDydId");
   ASSERT_EQ(t.getCriteriaFile(), "MyCrtFile");
+  ASSERT_EQ(t.getGroup(), "MyGroup");
+  ASSERT_TRUE(t.getEvents().empty());
+  Scenario::Event event;
+  event.elementId_ = "MyLine";
+  event.time_ = 1.;
+  t.addEvent(event);
+  event.elementId_ = "MyLoad";
+  event.type_ = Scenario::Event::INJECTION_DISCONNECTION;
+  Scenario::Event::Parameter parameter;
+  parameter.name_ = "event_open";
+  parameter.type_ = "BOOL";
+  parameter.value_ = "false";
+  event.parameters_.push_back(parameter);
+  t.addEvent(event);
+  ASSERT_EQ(t.getEvents().size(), 2);
+  ASSERT_EQ(t.getEvents()[0].elementId_, "MyLine");
+  ASSERT_EQ(t.getEvents()[0].type_, Scenario::Event::BRANCH_DISCONNECTION);
+  ASSERT_DOUBLE_EQ(t.getEvents()[0].time_, 1.);
+  ASSERT_TRUE(t.getEvents()[0].parameters_.empty());
+  ASSERT_EQ(t.getEvents()[1].elementId_, "MyLoad");
+  ASSERT_EQ(t.getEvents()[1].type_, Scenario::Event::INJECTION_DISCONNECTION);
+  ASSERT_EQ(t.getEvents()[1].parameters_.size(), 1);
+  ASSERT_EQ(t.getEvents()[1].parameters_[0].name_, "event_open");
+  ASSERT_EQ(t.getEvents()[1].parameters_[0].type_, "BOOL");
+  ASSERT_EQ(t.getEvents()[1].parameters_[0].value_, "false");
+}
+
+TEST(TestBaseClasses, testInputsHash) {
+  InputsHash h1;
+  InputsHash h2;
+  ASSERT_EQ(h1.str(), h2.str());
+  h1.addString("MyValue");
+  ASSERT_NE(h1.str(), h2.str());
+  h2.addString("MyValue");
+  ASSERT_EQ(h1.str(), h2.str());
+  h1.addFile("MyMissingFile");
+  h2.addString("");
+  ASSERT_EQ(h1.str(), h2.str());
+
+  InputsHash h3;
+  h3.addString("ab");
+  h3.addString("c");
+  InputsHash h4;
+  h4.addString("a");
+  h4.addString("bc");
+  ASSERT_NE(h3.str(), h4.str());
 }
 
 TEST(TestBaseClasses, testScenarios) {
   Scenarios s;
   ASSERT_TRUE(s.getScenarios().empty());
   ASSERT_TRUE(s.getJobsFile().empty());
+  ASSERT_EQ(s.getInitialization(), Scenarios::INIT_EACH_SCENARIO);
+  ASSERT_TRUE(s.getResultsCacheDirectory().empty());
+  ASSERT_DOUBLE_EQ(s.getScreeningDuration(), 0.);
+  ASSERT_EQ(s.getOutputsRetention(), Scenarios::OUTPUTS_ALL);
+  ASSERT_TRUE(s.keepsOutputs(CONVERGENCE_STATUS));
+  ASSERT_TRUE(s.keepsOutputs(DIVERGENCE_STATUS));
   boost::shared_ptr<Scenario> t1(new Scenario());
   t1->setId("MyId1");
   t1->setDydFile("MyDydFile1");
@@ -56,6 +111,9 @@ TEST(TestBaseClasses, testScenarios) {
   s.addScenario(t1);
   s.addScenario(t2);
   s.setJobsFile("myJobsFile");
+  s.setInitialization(Scenarios::INIT_SHARED);
+  s.setResultsCacheDirectory("myCache");
+  s.setScreeningDuration(2.);
   ASSERT_EQ(s.getScenarios().size(), 2);
   ASSERT_EQ(s.getScenarios()[0]->getId(), "MyId1");
   ASSERT_EQ(s.getScenarios()[0]->getDydFile(), "MyDydFile1");
@@ -64,14 +122,52 @@ TEST(TestBaseClasses, testScenarios) {
   ASSERT_EQ(s.getScenarios()[1]->getDydFile(), "MyDydFile2");
   ASSERT_EQ(s.getScenarios()[1]->getCriteriaFile(), "MyCrtFile2");
   ASSERT_EQ(s.getJobsFile(), "myJobsFile");
+  ASSERT_EQ(s.getInitialization(), Scenarios::INIT_SHARED);
+  ASSERT_EQ(s.getResultsCacheDirectory(), "myCache");
+  ASSERT_DOUBLE_EQ(s.getScreeningDuration(), 2.);
+  s.setOutputsRetention(Scenarios::OUTPUTS_NON_CONVERGENCE);
+  ASSERT_EQ(s.getOutputsRetention(), Scenarios::OUTPUTS_NON_CONVERGENCE);
+  ASSERT_FALSE(s.keepsOutputs(CONVERGENCE_STATUS));
+  ASSERT_TRUE(s.keepsOutputs(DIVERGENCE_STATUS));
+  ASSERT_TRUE(s.keepsOutputs(CRITERIA_NON_RESPECTED_STATUS));
+  ASSERT_FALSE(s.keepsOutputs(RESULT_FOUND_STATUS));
+  ASSERT_TRUE(s.keepsOutputs(CT_BELOW_MIN_BOUND_STATUS));
+  ASSERT_TRUE(s.keepsOutputs(CT_ABOVE_MAX_BOUND_STATUS));
+  s.setOutputsRetention(Scenarios::OUTPUTS_CRITERIA_NON_RESPECTED);
+  ASSERT_EQ(s.getOutputsRetention(), Scenarios::OUTPUTS_CRITERIA_NON_RESPECTED);
+  ASSERT_FALSE(s.keepsOutputs(CONVERGENCE_STATUS));
+  ASSERT_FALSE(s.keepsOutputs(DIVERGENCE_STATUS));
+  ASSERT_TRUE(s.keepsOutputs(CRITERIA_NON_RESPECTED_STATUS));
+  ASSERT_FALSE(s.keepsOutputs(RESULT_FOUND_STATUS));
+  ASSERT_FALSE(s.keepsOutputs(CT_BELOW_MIN_BOUND_STATUS));
+  ASSERT_FALSE(s.getSteadyStateDetection());
+  boost::shared_ptr<SteadyStateDetection> steadyStateDetection(new SteadyStateDetection());
+  ASSERT_DOUBLE_EQ(steadyStateDetection->getWindow(), 10.);
+  ASSERT_DOUBLE_EQ(steadyStateDetection->getThreshold(), 1e-4);
+  ASSERT_TRUE(steadyStateDetection->getVariables().empty());
+  steadyStateDetection->setWindow(5.);
+  steadyStateDetection->setThreshold(1e-3);
+  steadyStateDetection->addVariable("MyModel", "MyVariable");
+  s.setSteadyStateDetection(steadyStateDetection);
+  ASSERT_TRUE(s.getSteadyStateDetection());
+  ASSERT_DOUBLE_EQ(s.getSteadyStateDetection()->getWindow(), 5.);
+  ASSERT_DOUBLE_EQ(s.getSteadyStateDetection()->getThreshold(), 1e-3);
+  ASSERT_EQ(s.getSteadyStateDetection()->getVariables().size(), 1);
+  ASSERT_EQ(s.getSteadyStateDetection()->getVariables()[0].first, "MyModel");
+  ASSERT_EQ(s.getSteadyStateDetection()->getVariables()[0].second, "MyVariable");
 }
 
 TEST(TestBaseClasses, testMarginCalculation) {
   MarginCalculation mc;
   assert(!mc.getScenarios());
   assert(!mc.getLoadIncrease());
+  ASSERT_TRUE(mc.getLoadIncreases().empty());
   ASSERT_EQ(mc.getAccuracy(), 5.);
   ASSERT_EQ(mc.getCalculationType(), MarginCalculation::GLOBAL_MARGIN);
+  ASSERT_TRUE(mc.getPreviousResultsFile().empty());
+  ASSERT_FALSE(mc.getArchiveLoadIncreaseStates());
+  ASSERT_DOUBLE_EQ(mc.getScreeningDuration(), 0.);
+  ASSERT_EQ(mc.getLevelSelection(), MarginCalculation::BISECTION);
   boost::shared_ptr<LoadIncrease> t1(new LoadIncrease());
   t1->setId("MyId1");
   t1->setJobsFile("MyJobsFile1");
@@ -84,12 +180,16 @@ TEST(TestBaseClasses, testMarginCalculation) {
   t3->setDydFile("MyDydFile3");
   t3->setCriteriaFile("MyCrtFile3");
   boost::shared_ptr<Scenarios> scenarios(new Scenarios());
-  mc.setLoadIncrease(t1);
+  mc.addLoadIncrease(t1);
   scenarios->addScenario(t2);
   scenarios->addScenario(t3);
   mc.setScenarios(scenarios);
   mc.setAccuracy(52);
   mc.setCalculationType(MarginCalculation::LOCAL_MARGIN);
+  mc.setPreviousResultsFile("MyAggregatedResults.xml");
+  mc.setArchiveLoadIncreaseStates(true);
+  mc.setScreeningDuration(10.);
+  mc.setLevelSelection(MarginCalculation::ACTIVE_LEARNING);
   ASSERT_EQ(mc.getLoadIncrease()->getId(), "MyId1");
   ASSERT_EQ(mc.getLoadIncrease()->getJobsFile(), "MyJobsFile1");
   ASSERT_EQ(mc.getScenarios()->getScenarios().size(), 2);
@@ -101,20 +201,49 @@ TEST(TestBaseClasses, testMarginCalculation) {
   ASSERT_EQ(mc.getScenarios()->getScenarios()[1]->getCriteriaFile(), "MyCrtFile3");
   ASSERT_EQ(mc.getAccuracy(), 52);
   ASSERT_EQ(mc.getCalculationType(), MarginCalculation::LOCAL_MARGIN);
+  ASSERT_EQ(mc.getPreviousResultsFile(), "MyAggregatedResults.xml");
+  ASSERT_TRUE(mc.getArchiveLoadIncreaseStates());
+  ASSERT_DOUBLE_EQ(mc.getScreeningDuration(), 10.);
+  ASSERT_EQ(mc.getLevelSelection(), MarginCalculation::ACTIVE_LEARNING);
 
   ASSERT_THROW_DYNAWO(mc.setAccuracy(-1), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::IncoherentAccuracy);
   ASSERT_THROW_DYNAWO(mc.setAccuracy(101), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::IncoherentAccuracy);
   ASSERT_THROW_DYNAWO(mc.setAccuracy(0), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::IncoherentAccuracy);
+
+  boost::shared_ptr<LoadIncrease> t4(new LoadIncrease());
+  t4->setId("MyId4");
+  t4->setJobsFile("MyJobsFile4");
+  mc.addLoadIncrease(t4);
+  ASSERT_EQ(mc.getLoadIncreases().size(), 2);
+  ASSERT_EQ(mc.getLoadIncrease()->getId(), "MyId1");
+  ASSERT_EQ(mc.getLoadIncreases()[1]->getId(), "MyId4");
+  ASSERT_EQ(mc.getLoadIncreases()[1]->getJobsFile(), "MyJobsFile4");
+  ASSERT_THROW_DYNAWO(mc.addLoadIncrease(t4), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::LoadIncreaseIdNotUnique);
 }
 
 TEST(TestBaseClasses, testCriticalTimeCalculation) {
   CriticalTimeCalculation ct;
+  ASSERT_DOUBLE_EQ(ct.getPreFaultTime(), 0.);
+  ASSERT_FALSE(ct.getFaultOnBranching());
+  ASSERT_FALSE(ct.getInterpolatedSearch());
+  ASSERT_FALSE(ct.getInstabilityDetection());
+  ASSERT_DOUBLE_EQ(ct.getPriorMargin(), 0.);
   ct.setAccuracy(0.01);
   ct.setDydId("MyDydId");
   ct.setParName("MyParName");
   ct.setMinValue(1);
   ct.setMaxValue(2);
   ct.setMode(CriticalTimeCalculation::SIMPLE);
+  ct.setPreFaultTime(0.8);
+  ct.setFaultOnBranching(true);
+  ct.setInterpolatedSearch(true);
+  ct.setPriorMargin(0.02);
+  boost::shared_ptr<InstabilityDetection> instabilityDetection(new InstabilityDetection());
+  ASSERT_DOUBLE_EQ(instabilityDetection->getWindow(), 0.1);
+  ASSERT_TRUE(instabilityDetection->getVariables().empty());
+  instabilityDetection->setWindow(0.05);
+  instabilityDetection->addVariable("MyModel", "MyVariable", 0.9, 1.1);
+  ct.setInstabilityDetection(instabilityDetection);
   boost::shared_ptr<Scenario> t1(new Scenario());
   t1->setId("MyId1");
   t1->setDydFile("MyDydFile1");
@@ -137,6 +266,17 @@ TEST(TestBaseClasses, testCriticalTimeCalculation) {
   ASSERT_EQ(ct.getMinValue(), 1);
   ASSERT_EQ(ct.getMaxValue(), 2);
   ASSERT_EQ(ct.getMode(), CriticalTimeCalculation::SIMPLE);
+  ASSERT_DOUBLE_EQ(ct.getPreFaultTime(), 0.8);
+  ASSERT_TRUE(ct.getFaultOnBranching());
+  ASSERT_TRUE(ct.getInterpolatedSearch());
+  ASSERT_DOUBLE_EQ(ct.getPriorMargin(), 0.02);
+  ASSERT_TRUE(ct.getInstabilityDetection());
+  ASSERT_DOUBLE_EQ(ct.getInstabilityDetection()->getWindow(), 0.05);
+  ASSERT_EQ(ct.getInstabilityDetection()->getVariables().size(), 1);
+  ASSERT_EQ(ct.getInstabilityDetection()->getVariables()[0].modelId_, "MyModel");
+  ASSERT_EQ(ct.getInstabilityDetection()->getVariables()[0].variableName_, "MyVariable");
+  ASSERT_DOUBLE_EQ(ct.getInstabilityDetection()->getVariables()[0].minValue_, 0.9);
+  ASSERT_DOUBLE_EQ(ct.getInstabilityDetection()->getVariables()[0].maxValue_, 1.1);
   ASSERT_EQ(ct.getScenarios()->getJobsFile(), "Myjobs.jobs");
   ASSERT_EQ(ct.getScenarios()->getScenarios().size(), 3);
   ASSERT_EQ(ct.getScenarios()->getScenarios()[0]->getId(), "MyId1");
@@ -149,6 +289,27 @@ TEST(TestBaseClasses, testCriticalTimeCalculation) {
   ASSERT_EQ(ct.getScenarios()->getScenarios()[2]->getDydFile(), "MyDydFile3");
   ASSERT_EQ(ct.getScenarios()->getScenarios()[2]->getDydId(), "MyDydId");
 
+  ASSERT_TRUE(ct.getTargets().empty());
+  CriticalTimeCalculation::Target target;
+  target.id_ = "MyTarget";
+  target.dydId_ = "MyProtection";
+  target.parName_ = "MyDelay";
+  target.minValue_ = 0.1;
+  target.maxValue_ = 0.5;
+  ct.addTarget(target);
+  ASSERT_EQ(ct.getTargets().size(), 1);
+  ASSERT_EQ(ct.getTargets()[0].id_, "MyTarget");
+  ASSERT_EQ(ct.getTargets()[0].dydId_, "MyProtection");
+  ASSERT_EQ(ct.getTargets()[0].parName_, "MyDelay");
+  ASSERT_DOUBLE_EQ(ct.getTargets()[0].minValue_, 0.1);
+  ASSERT_DOUBLE_EQ(ct.getTargets()[0].maxValue_, 0.5);
+  ASSERT_NO_THROW(ct.checkGapBetweenMinValueAndMaxValue());
+  ASSERT_THROW_DYNAWO(ct.addTarget(target), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::CriticalTimeTargetIdNotUnique);
+  target.id_ = "MyTarget2";
+  target.minValue_ = 0.495;
+  ct.addTarget(target);
+  ASSERT_THROW_DYNAWO(ct.checkGapBetweenMinValueAndMaxValue(), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::IncoherentMinAndMaxValue);
+
   ASSERT_THROW_DYNAWO(ct.setAccuracy(-1), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::IncoherentAccuracyCriticalTime);
   ct.setMinValue(3);
   ASSERT_THROW_DYNAWO(ct.checkGapBetweenMinValueAndMaxValue(), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::IncoherentMinAndMaxValue);
@@ -163,6 +324,9 @@ TEST(TestBaseClasses, testSimulationResult) {
   ASSERT_EQ(sr.getConstraintsFileExtension(), "xml");
   ASSERT_EQ(sr.getTimelineFileExtension(), "xml");
   ASSERT_EQ(sr.getLostEquipmentsFileExtension(), "xml");
+  ASSERT_FALSE(sr.isStoppedOnSteadyState());
+  ASSERT_FALSE(sr.isStoppedOnInstability());
+  ASSERT_FALSE(sr.isScreening());
   sr.setScenarioId("MyId");
   sr.setVariation(50.);
   sr.setSuccess(true);
@@ -175,6 +339,9 @@ TEST(TestBaseClasses, testSimulationResult) {
   sr.setTimelineFileExtension("log");
   sr.setLostEquipmentsFileExtension("log");
   sr.setLogPath("Test LogPath");
+  sr.setSteadyStateTime(25.);
+  sr.setInstability(12., "MyInstability");
+  sr.setScreening(true);
   std::vector<std::pair<double, std::string> > failingCriteria;
   failingCriteria.push_back(std::make_pair(10, "MyCriteria"));
   sr.setFailingCriteria(failingCriteria);
@@ -191,6 +358,12 @@ TEST(TestBaseClasses, testSimulationResult) {
   ASSERT_EQ(sr.getTimelineFileExtension(), "log");
   ASSERT_EQ(sr.getLostEquipmentsFileExtension(), "log");
   ASSERT_EQ(sr.getLogPath(), "Test LogPath");
+  ASSERT_TRUE(sr.isStoppedOnSteadyState());
+  ASSERT_DOUBLE_EQ(sr.getSteadyStateTime(), 25.);
+  ASSERT_TRUE(sr.isStoppedOnInstability());
+  ASSERT_DOUBLE_EQ(sr.getInstabilityTime(), 12.);
+  ASSERT_EQ(sr.getInstabilityReason(), "MyInstability");
+  ASSERT_TRUE(sr.isScreening());
   ASSERT_EQ(sr.getFailingCriteria().size(), 1);
   ASSERT_EQ(sr.getFailingCriteria()[0].second, "MyCriteria");
   ASSERT_EQ(sr.getFailingCriteria()[0].first, 10);
@@ -208,6 +381,9 @@ TEST(TestBaseClasses, testSimulationResult) {
   ASSERT_EQ(srCopy.getTimelineFileExtension(), "log");
   ASSERT_EQ(srCopy.getLostEquipmentsFileExtension(), "log");
   ASSERT_EQ(srCopy.getLogPath(), "Test LogPath");
+  ASSERT_DOUBLE_EQ(srCopy.getInstabilityTime(), 12.);
+  ASSERT_EQ(srCopy.getInstabilityReason(), "MyInstability");
+  ASSERT_TRUE(srCopy.isScreening());
   ASSERT_EQ(srCopy.getFailingCriteria().size(), 1);
   ASSERT_EQ(srCopy.getFailingCriteria()[0].first, 10);
   ASSERT_EQ(srCopy.getFailingCriteria()[0].second, "MyCriteria");
@@ -233,6 +409,9 @@ TEST(TestBaseClasses, testSimulationResult) {
   ASSERT_EQ(srCopy2.getTimelineFileExtension(), "log");
   ASSERT_EQ(srCopy2.getLostEquipmentsFileExtension(), "log");
   ASSERT_EQ(srCopy2.getLogPath(), "Test LogPath");
+  ASSERT_DOUBLE_EQ(srCopy2.getInstabilityTime(), 12.);
+  ASSERT_EQ(srCopy2.getInstabilityReason(), "MyInstability");
+  ASSERT_TRUE(srCopy2.isScreening());
   ASSERT_EQ(srCopy2.getFailingCriteria().size(), 1);
   ASSERT_EQ(srCopy2.getFailingCriteria()[0].first, 10);
   ASSERT_EQ(srCopy2.getFailingCriteria()[0].second, "MyCriteria");
@@ -271,10 +450,27 @@ TEST(TestBaseClasses, testSimulationResult) {
   ASSERT_EQ(srMove2.getFailingCriteria().size(), 1);
   ASSERT_EQ(srMove2.getFailingCriteria()[0].first, 10);
   ASSERT_EQ(srMove2.getFailingCriteria()[0].second, "MyCriteria");
+
+  srMove2.clearOutputs();
+  ASSERT_TRUE(srMove2.getConstraintsStreamStr().empty());
+  ASSERT_TRUE(srMove2.getTimelineStreamStr().empty());
+  ASSERT_TRUE(srMove2.getLostEquipementsStreamStr().empty());
+  ASSERT_TRUE(srMove2.getOutputIIDMStreamStr().empty());
+  ASSERT_EQ(srMove2.getStatus(), CONVERGENCE_STATUS);
+  ASSERT_EQ(srMove2.getFailingCriteria().size(), 1);
 }
 
 TEST(TestBaseClasses, testLoadIncreaseResult) {
   LoadIncreaseResult lir(2);
+  ASSERT_TRUE(lir.getLoadIncreaseId().empty());
+  lir.setLoadIncreaseId("MyLoadIncrease");
+  ASSERT_EQ(lir.getLoadIncreaseId(), "MyLoadIncrease");
+  ASSERT_FALSE(lir.isScreening());
+  lir.setScreening(true);
+  ASSERT_TRUE(lir.isScreening());
+  ASSERT_FALSE(lir.isDecided());
+  lir.setDecided(true);
+  ASSERT_TRUE(lir.isDecided());
   lir.getResult().setScenarioId("MyId1");
   lir.getResult().setVariation(82.);
   lir.getResult().setSuccess(true);
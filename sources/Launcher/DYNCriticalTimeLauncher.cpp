@@ -18,6 +18,11 @@
  *
  */
 
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <set>
+
 #include <DYNExecUtils.h>
 #include <DYNSimulation.h>
 #include <DYNSubModel.h>
@@ -73,22 +78,126 @@ static DYN::TraceStream TraceInfo(const std::string& tag = "") {
 void
 CriticalTimeLauncher::setParametersAndLaunchSimulation(const std::string& workingDir, std::shared_ptr<CriticalTimeCalculation> criticalTimeCalculation,
    const boost::shared_ptr<Scenario>& scenario, SimulationResult& result, double& tSup) {
-  std::shared_ptr<job::JobEntry> job = inputs_.cloneJobEntry();
+  SimulationParameters params;
+  if (!criticalTimeCalculation->getFaultOnBranching()) {
+    launchFaultSimulation(workingDir, criticalTimeCalculation, scenario, initialStart_, tSup, params, result);
+    return;
+  }
+  // only the post-clearing part is simulated, from the state of the fault-on trajectory at the clearing time
+  const SimulationStart* faultOnState = findOrLaunchFaultOnState(workingDir, criticalTimeCalculation, scenario, tSup, result);
+  if (faultOnState)
+    launchFaultSimulation(workingDir, criticalTimeCalculation, scenario, *faultOnState, tSup, params, result);
+}
+
+void
+CriticalTimeLauncher::launchFaultSimulation(const std::string& workingDir, const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation,
+    const boost::shared_ptr<Scenario>& scenario, const SimulationStart& start, double faultEnd, SimulationParameters& params, SimulationResult& result,
+    bool retainOutputs) {
+  std::shared_ptr<job::JobEntry> job = start.inputs_.cloneJobEntry();
   const std::string& dydFile = scenario->getDydFile();
   addDydFileToJob(job, dydFile);
-  SimulationParameters params;
-  boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, inputs_);
+  if (!start.stateFile_.empty()) {
+    params.InitialStateFile_ = start.stateFile_;
+    params.iidmFile_ = start.iidmFile_;
+  }
+  if (start.time_ > 0. || DYN::doubleIsZero(start.time_))
+    params.startTime_ = start.time_;
+  boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, start.inputs_);
   if (simulation) {
     std::shared_ptr<DYN::ModelMulti> modelMulti = std::dynamic_pointer_cast<DYN::ModelMulti>(simulation->getModel());
     const std::string& dydId = scenario->getDydId();
     const std::string& parName = criticalTimeCalculation->getParName();
     if (modelMulti->findSubModelByName(dydId) != NULL) {
       boost::shared_ptr<DYN::SubModel> subModel_ = modelMulti->findSubModelByName(dydId);
-      subModel_->setParameterValue(parName, DYN::PAR, tSup, false);
+      subModel_->setParameterValue(parName, DYN::PAR, faultEnd, false);
       subModel_->setSubModelParameters();
     }
-    simulate(simulation, result);
+    // the instability detection only starts after the clearing of the fault, if it happens in this simulation
+    simulate(simulation, result, DYN::doubleGreater(simulation->getStopTime(), faultEnd) ? faultEnd : -1., retainOutputs);
+  }
+}
+
+const CriticalTimeLauncher::SimulationStart*
+CriticalTimeLauncher::findOrLaunchFaultOnState(const std::string& workingDir, const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation,
+    const boost::shared_ptr<Scenario>& scenario, double tEnd, SimulationResult& result) {
+  auto found = faultOnStates_.find(tEnd);
+  if (found != faultOnStates_.end())
+    return &found->second;
+  if (faultOnFailureTime_ >= 0. && !DYN::doubleGreater(faultOnFailureTime_, tEnd)) {
+    // the simulation clearing the fault at tEnd fails the same way
+    result.setSuccess(false);
+    result.setStatus(faultOnFailure_.getStatus());
+    result.setFailingCriteria(faultOnFailure_.getFailingCriteria());
+    return NULL;
+  }
+
+  // the checkpoints after the latest state dumped before the clearing time are dumped on the way, in increasing order
+  auto next = faultOnStates_.lower_bound(tEnd);
+  const double tLatest = next == faultOnStates_.begin() ? -1. : std::prev(next)->first;
+  const std::vector<double> checkpoints = computeFaultOnCheckpoints(criticalTimeCalculation->getMinValue(), criticalTimeCalculation->getMaxValue(),
+      criticalTimeCalculation->getAccuracy());
+  for (const auto checkpoint : checkpoints) {
+    if (!DYN::doubleGreater(checkpoint, tLatest))
+      continue;
+    if (!DYN::doubleGreater(tEnd, checkpoint))
+      break;
+    if (!launchFaultOnSegment(workingDir, criticalTimeCalculation, scenario, checkpoint, result))
+      return NULL;
+  }
+  return launchFaultOnSegment(workingDir, criticalTimeCalculation, scenario, tEnd, result);
+}
+
+const CriticalTimeLauncher::SimulationStart*
+CriticalTimeLauncher::launchFaultOnSegment(const std::string& workingDir, const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation,
+    const boost::shared_ptr<Scenario>& scenario, double tEnd, SimulationResult& result) {
+  auto next = faultOnStates_.lower_bound(tEnd);
+  const SimulationStart& start = next == faultOnStates_.begin() ? initialStart_ : std::prev(next)->second;
+  const std::string stateName = computeFaultOnStateName(tEnd);
+  SimulationStart faultOnState;
+  faultOnState.time_ = tEnd;
+  faultOnState.stateFile_ = createAbsolutePath(stateName + ".dmp", workingDir);
+  faultOnState.iidmFile_ = createAbsolutePath(stateName + ".iidm", workingDir);
+  SimulationParameters params;
+  params.activateDumpFinalState_ = true;
+  params.activateExportIIDM_ = true;
+  params.dumpFinalStateFile_ = faultOnState.stateFile_;
+  params.exportIIDMFile_ = faultOnState.iidmFile_;
+  params.stopTime_ = tEnd;
+  SimulationResult faultOnResult;
+  // the fault is not cleared before the end of this simulation, whose outputs are never exported
+  launchFaultSimulation(workingDir, criticalTimeCalculation, scenario, start, criticalTimeCalculation->getMaxValue() + 1., params, faultOnResult,
+      false);
+  if (!faultOnResult.getSuccess()) {
+    // the simulations clearing the fault at tEnd or later fail the same way
+    faultOnFailure_ = faultOnResult;
+    faultOnFailureTime_ = tEnd;
+    result.setSuccess(false);
+    result.setStatus(faultOnResult.getStatus());
+    result.setFailingCriteria(faultOnResult.getFailingCriteria());
+    return NULL;
+  }
+  faultOnState.inputs_.readInputs(workingDirectory_, baseJobsFile_, faultOnState.iidmFile_);
+  return &(faultOnStates_[tEnd] = faultOnState);
+}
+
+std::string
+CriticalTimeLauncher::computeFaultOnStateName(double time) const {
+  // the times are written with a fixed precision so that two close checkpoints never share the same state files
+  std::stringstream stateName;
+  stateName << "faultOnState-" << std::fixed << std::setprecision(15) << time;
+  return stateName.str();
+}
+
+std::vector<double>
+CriticalTimeLauncher::computeFaultOnCheckpoints(double minValue, double maxValue, double accuracy) {
+  std::set<double, dynawoDoubleLess> checkpoints;
+  const unsigned int nbIntervals = 1u << faultOnCheckpointsLevels_;
+  for (unsigned int i = 1; i < nbIntervals; ++i) {
+    const double checkpoint = round(minValue + i * (maxValue - minValue) / nbIntervals, accuracy);
+    if (DYN::doubleGreater(checkpoint, minValue) && DYN::doubleGreater(maxValue, checkpoint))
+      checkpoints.insert(checkpoint);
   }
+  return std::vector<double>(checkpoints.begin(), checkpoints.end());
 }
 
 void
@@ -105,35 +214,45 @@ CriticalTimeLauncher::launch() {
   if (!scenarios) {
     throw DYNAlgorithmsError(SystematicAnalysisTaskNotFound);
   }
-  const std::vector<boost::shared_ptr<Scenario> >& events = scenarios->getScenarios();
+  const std::vector<Research> researches = listResearches(criticalTimeCalculation);
 
   auto& context = multiprocessing::context();
   if (context.isRootProc()) {
     // only required for root proc
-    results_.resize(events.size());
+    results_.resize(researches.size());
   }
 
-  multiprocessing::forEach(0, events.size(), [this, &events](unsigned int i) {
-    std::string workingDir  = createAbsolutePath(events[i]->getId(), workingDirectory_);
+  multiprocessing::forEach(0, researches.size(), [this, &researches](unsigned int i) {
+    std::string workingDir  = createAbsolutePath(researches[i].scenario_->getId(), workingDirectory_);
     if (!exists(workingDir))
       createDirectory(workingDir);
     else if (!isDirectory(workingDir))
       throw DYNAlgorithmsError(DirectoryDoesNotExist, workingDir);
   });
 
+  baseJobsFile_ = baseJobsFile;
+  instabilityDetection_ = criticalTimeCalculation->getInstabilityDetection();
   inputs_.readInputs(workingDirectory_, baseJobsFile);
+  initialStart_ = SimulationStart();
+  initialStart_.inputs_ = inputs_;
+  if (criticalTimeCalculation->getPreFaultTime() > 0.)
+    launchPreFaultSimulation(baseJobsFile, criticalTimeCalculation->getPreFaultTime());
 
-  multiprocessing::forEach(0, events.size(), [this, &events, criticalTimeCalculation](unsigned int i){
-    CriticalTimeResult ret = launchScenario(events[i], criticalTimeCalculation);
-    exportCTCResult(ret);
-  });
+  if (criticalTimeCalculation->getPriorMargin() > 0.) {
+    launchResearchesWithPriors(researches);
+  } else {
+    multiprocessing::forEach(0, researches.size(), [this, &researches](unsigned int i){
+      CriticalTimeResult ret = launchScenario(researches[i].scenario_, researches[i].criticalTimeCalculation_);
+      exportCTCResult(ret);
+    });
+  }
 
   multiprocessing::Context::sync();
 
   // Update results for root proc
   if (context.isRootProc()) {
-    for (unsigned int i = 0; i < events.size(); i++) {
-      const auto& scenario = events.at(i);
+    for (unsigned int i = 0; i < researches.size(); i++) {
+      const auto& scenario = researches.at(i).scenario_;
       results_.at(i) = importCTCResult(scenario->getId());
       cleanResult(scenario->getId());
     }
@@ -146,8 +265,123 @@ CriticalTimeLauncher::launch() {
   TraceInfo(logTag_) << "============================================================ " << DYN::Trace::endline;
 }
 
+void
+CriticalTimeLauncher::launchPreFaultSimulation(const std::string& baseJobsFile, double preFaultTime) {
+  const std::string dumpFile = createAbsolutePath("preFaultState.dmp", workingDirectory_);
+  const std::string iidmFile = createAbsolutePath("preFaultState.iidm", workingDirectory_);
+  bool success = false;
+  if (multiprocessing::context().isRootProc()) {
+    std::string workingDir = createAbsolutePath("preFault", workingDirectory_);
+    if (!exists(workingDir))
+      createDirectory(workingDir);
+    std::shared_ptr<job::JobEntry> job = inputs_.cloneJobEntry();
+    SimulationParameters params;
+    params.activateDumpFinalState_ = true;
+    params.activateExportIIDM_ = true;
+    params.dumpFinalStateFile_ = dumpFile;
+    params.exportIIDMFile_ = iidmFile;
+    params.stopTime_ = preFaultTime;
+    SimulationResult result;
+    boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, inputs_);
+    if (simulation) {
+      // only the dumped state is used
+      simulate(simulation, result, -1., false);
+      success = result.getSuccess();
+    }
+  }
+  // the other processes wait for the root process and then read the dumped state from the working directory
+  multiprocessing::context().broadcast(success);
+  if (!success) {
+    TraceInfo(logTag_) << DYNAlgorithmsLog(PreFaultStateFailed, preFaultTime) << DYN::Trace::endline;
+    return;
+  }
+  initialStart_.time_ = preFaultTime;
+  initialStart_.stateFile_ = dumpFile;
+  initialStart_.iidmFile_ = iidmFile;
+  initialStart_.inputs_.readInputs(workingDirectory_, baseJobsFile, iidmFile);
+  TraceInfo(logTag_) << DYNAlgorithmsLog(PreFaultStateShared, preFaultTime) << DYN::Trace::endline;
+}
+
+std::vector<CriticalTimeLauncher::Research>
+CriticalTimeLauncher::listResearches(const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation) const {
+  const std::vector<boost::shared_ptr<Scenario> >& scenarios = criticalTimeCalculation->getScenarios()->getScenarios();
+  const std::vector<CriticalTimeCalculation::Target>& targets = criticalTimeCalculation->getTargets();
+  std::vector<Research> researches;
+  if (targets.empty()) {
+    for (const auto& scenario : scenarios) {
+      Research research;
+      research.scenario_ = scenario;
+      research.criticalTimeCalculation_ = criticalTimeCalculation;
+      researches.push_back(research);
+    }
+    return researches;
+  }
+
+  // the researches of all the targets share the inputs and the pre-fault state of the calculation
+  std::vector<std::shared_ptr<CriticalTimeCalculation> > targetCalculations;
+  for (const auto& target : targets) {
+    std::shared_ptr<CriticalTimeCalculation> targetCalculation(new CriticalTimeCalculation(*criticalTimeCalculation));
+    targetCalculation->setParName(target.parName_);
+    targetCalculation->setMinValue(target.minValue_);
+    targetCalculation->setMaxValue(target.maxValue_);
+    targetCalculations.push_back(targetCalculation);
+  }
+  for (const auto& scenario : scenarios) {
+    for (size_t i = 0; i < targets.size(); ++i) {
+      Research research;
+      research.scenario_ = boost::shared_ptr<Scenario>(new Scenario(*scenario));
+      research.scenario_->setId(scenario->getId() + "-" + targets[i].id_);
+      if (!targets[i].dydId_.empty())
+        research.scenario_->setDydId(targets[i].dydId_);
+      // the critical values of different targets are not comparable
+      research.scenario_->setGroup((scenario->getGroup().empty() ? research.scenario_->getDydId() : scenario->getGroup()) + "-" + targets[i].id_);
+      research.criticalTimeCalculation_ = targetCalculations[i];
+      researches.push_back(research);
+    }
+  }
+  return researches;
+}
+
+void
+CriticalTimeLauncher::launchResearchesWithPriors(const std::vector<Research>& researches) {
+  std::map<std::string, unsigned int> groupLeaders;  // index of the leader of each group
+  std::vector<unsigned int> leaders;
+  std::vector<std::pair<unsigned int, unsigned int> > followers;  // (index of the research, index of the leader of its group)
+  for (unsigned int i = 0; i < researches.size(); ++i) {
+    const boost::shared_ptr<Scenario>& scenario = researches[i].scenario_;
+    const std::string& group = scenario->getGroup().empty() ? scenario->getDydId() : scenario->getGroup();
+    auto groupLeader = groupLeaders.insert(std::make_pair(group, i));
+    if (groupLeader.second)
+      leaders.push_back(i);
+    else
+      followers.push_back(std::make_pair(i, groupLeader.first->second));
+  }
+
+  multiprocessing::forEach(0, leaders.size(), [this, &researches, &leaders](unsigned int i) {
+    const Research& research = researches[leaders[i]];
+    exportCTCResult(launchScenario(research.scenario_, research.criticalTimeCalculation_));
+  });
+
+  // the results of the leaders are read back from their save files, whichever process computed them
+  multiprocessing::Context::sync();
+
+  multiprocessing::forEach(0, followers.size(), [this, &researches, &followers](unsigned int i) {
+    const Research& research = researches[followers[i].first];
+    const boost::shared_ptr<Scenario>& scenario = research.scenario_;
+    const std::string& leaderId = researches[followers[i].second].scenario_->getId();
+    const CriticalTimeResult leaderResult = importCTCResult(leaderId);
+    double priorCriticalTime = -1.;
+    if (leaderResult.getStatus() == RESULT_FOUND_STATUS) {
+      priorCriticalTime = leaderResult.getCriticicalTime();
+      TraceInfo(logTag_) << DYNAlgorithmsLog(CriticalTimePriorSeeded, scenario->getId(), priorCriticalTime, leaderId) << DYN::Trace::endline;
+    }
+    exportCTCResult(launchScenario(scenario, research.criticalTimeCalculation_, priorCriticalTime));
+  });
+}
+
 CriticalTimeResult
-CriticalTimeLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario, std::shared_ptr<CriticalTimeCalculation> criticalTimeCalculation) {
+CriticalTimeLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario, std::shared_ptr<CriticalTimeCalculation> criticalTimeCalculation,
+    double priorCriticalTime) {
   if (multiprocessing::context().nbProcs() == 1)
     std::cout << " Launch scenario: " << scenario->getId() << " - dydFile: " << scenario->getDydFile() << " - dydId: " << scenario->getDydId() << std::endl;
   TraceInfo(logTag_) << DYNAlgorithmsLog(ScenarioLaunch, scenario->getId()) << DYN::Trace::endline;
@@ -160,7 +394,8 @@ CriticalTimeLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario
 
   const CriticalTimeCalculation::mode_t mode = criticalTimeCalculation->getMode();
   const double accuracy = criticalTimeCalculation->getAccuracy();
-  double tMax = criticalTimeCalculation->getMaxValue();  // Bound max of the time
+  const double maxValue = criticalTimeCalculation->getMaxValue();
+  double tMax = maxValue;  // Bound max of the time
   double tEnd = tMax;  // fault time end used in simulation
   double tLowestFailed = tMax;  // min time where all times higher lead to a failed simulation
   double tHighestSuccess = criticalTimeCalculation->getMinValue();  // max time where all times lower lead to a succeeded simulation
@@ -168,12 +403,40 @@ CriticalTimeLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario
   int nbSimulationsDone = 0;
   int nbSimulationsFailed = 0;
   std::unordered_map<double, std::pair<bool, status_t>> tTestedValues;  // stores every tested tEnd
+  const bool interpolatedSearch = criticalTimeCalculation->getInterpolatedSearch();
+  std::map<double, double> failureIndicators;  // stability indicator of the failed simulations, by tEnd
+  std::map<double, std::pair<double, std::string> > instabilities;  // instabilities detected in the failed simulations, by tEnd
+  double previousGap = tLowestFailed - tHighestSuccess;
+  bool interpolated = false;
+  double divergenceStep = 0.;  // distance below tLowestFailed of the time tested after a solver issue, 0 if none
+  double tPriorLower = -1.;  // lower bound of the bracket seeded by the prior critical time
+  int priorCheck = 0;  // 1 while the upper bound of the seeded bracket is tested, 2 while its lower bound is tested, 0 otherwise
+  const double priorMargin = criticalTimeCalculation->getPriorMargin();
+  if (priorCriticalTime >= 0. && priorMargin > 0.) {
+    // the seeded bracket is tested first, its upper bound being expected to fail and its lower bound to succeed
+    tMax = std::min(tMax, round(priorCriticalTime + priorMargin, accuracy));
+    tPriorLower = round(std::max(tHighestSuccess, priorCriticalTime - priorMargin), accuracy);
+    tEnd = round(tMax, accuracy);
+    priorCheck = 1;
+  }
+  faultOnStates_.clear();
+  faultOnFailureTime_ = -1.;
 
   // While difference between lowest time of fail and highest time of Success is higher than the accuracy then continue loop
   while (DYN::doubleGreater(round(tLowestFailed, accuracy)-round(tHighestSuccess, accuracy), accuracy)) {
     // Launch Simulation
     if (tTestedValues.find(tEnd) == tTestedValues.end()) {
+      // the result is shared by the iterations: nothing of the previous simulation must be read for this one
+      result.setInstability(-1., "");
+      result.setFailingCriteria(std::vector<std::pair<double, std::string> >());
       setParametersAndLaunchSimulation(workingDir, criticalTimeCalculation, scenario, result, tEnd);
+      if (result.isStoppedOnInstability())
+        instabilities[tEnd] = std::make_pair(result.getInstabilityTime(), result.getInstabilityReason());
+      if (interpolatedSearch && !result.getSuccess()) {
+        const double indicator = computeFailureIndicator(result, tEnd);
+        if (indicator > 0.)
+          failureIndicators[tEnd] = indicator;
+      }
     } else {  // if tested values already detected, no need to launch the simulation
       result.setSuccess(tTestedValues[tEnd].first);
       result.setStatus(tTestedValues[tEnd].second);
@@ -190,32 +453,71 @@ CriticalTimeLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario
     // Set tEnd, tMax et tHighestSuccess
     gap = tMax - tHighestSuccess;
     if (result.getSuccess()) {
+      divergenceStep = 0.;
       tHighestSuccess = tMax;
       tMax = std::min(tLowestFailed, tMax + gap/2);
-      if (nbSimulationsDone == 1) {break;}
+      if (DYN::doubleEquals(tHighestSuccess, maxValue)) {break;}
     } else {
       ++nbSimulationsFailed;
 
       if (mode == CriticalTimeCalculation::COMPLEX && result.getStatus() == DIVERGENCE_STATUS) {
-        // In case of solver issue, tMax become the previous lowest time with an issue minus the accuracy
-        if (DYN::doubleEquals(tMax, tLowestFailed - accuracy)) {tLowestFailed = tMax;}
-        tMax = tLowestFailed - accuracy;
+        tMax = computeTimeAfterDivergence(tMax, tHighestSuccess, tLowestFailed, divergenceStep, accuracy);
         if (tHighestSuccess > tMax) {break;}  // By lowering tMax this way, tHighestSuccess might become greater than tMax
       } else {
+        divergenceStep = 0.;
         tLowestFailed = tMax;
         tMax = tMax - gap/2;
       }
     }
+    if (interpolatedSearch && (mode != CriticalTimeCalculation::COMPLEX || result.getStatus() != DIVERGENCE_STATUS)) {
+      // the dichotomy is kept after an interpolation that did not at least halve the range
+      const double newGap = tLowestFailed - tHighestSuccess;
+      const double tInterpolated = (!interpolated || newGap < previousGap / 2.) ?
+          interpolateCriticalTime(failureIndicators, tHighestSuccess, tLowestFailed, accuracy) : -1.;
+      interpolated = tInterpolated >= 0.;
+      if (interpolated)
+        tMax = tInterpolated;
+      previousGap = newGap;
+    }
+    if (priorCheck > 0 && (mode != CriticalTimeCalculation::COMPLEX || result.getStatus() != DIVERGENCE_STATUS)) {
+      // the max value is tested when the upper bound of the seeded bracket succeeds, and the dichotomy goes on below its lower bound
+      // when it fails: the bracket is widened towards the bounds of the calculation when the prior turns out wrong
+      const bool upperBoundChecked = priorCheck == 1;
+      priorCheck = 0;
+      if (upperBoundChecked && result.getSuccess()) {
+        tMax = maxValue;
+      } else if (upperBoundChecked && DYN::doubleGreater(tPriorLower, tHighestSuccess)) {
+        tMax = tPriorLower;
+        priorCheck = 2;
+      } else if (!upperBoundChecked && result.getSuccess()) {
+        tMax = (tHighestSuccess + tLowestFailed) / 2.;
+      }
+    } else {
+      priorCheck = 0;
+    }
     tEnd = round(tMax, accuracy);
   }
 
+  for (const auto& faultOnState : faultOnStates_) {
+    remove(faultOnState.second.stateFile_);
+    remove(faultOnState.second.iidmFile_);
+  }
+  faultOnStates_.clear();
+
   // Set result
-  status = getFinalStatus(nbSimulationsDone, nbSimulationsFailed);
+  status = getFinalStatus(nbSimulationsDone, nbSimulationsFailed, DYN::doubleEquals(tHighestSuccess, maxValue));
+  // the outputs of the last simulation are kept according to the outcome of the whole calculation,
+  // the discarded ones are never written in the result file read by the root process
+  if (!criticalTimeCalculation->getScenarios()->keepsOutputs(status))
+    result.clearOutputs();
   CriticalTimeResult criticalTimeResult;
   criticalTimeResult.setId(scenario->getId());
   criticalTimeResult.setCriticalTime(round(tHighestSuccess, accuracy));
   criticalTimeResult.setResult(result);
   criticalTimeResult.setStatus(status);
+  auto instability = instabilities.find(round(tLowestFailed, accuracy));
+  if (instability != instabilities.end())
+    criticalTimeResult.setInstability(instability->second.first, instability->second.second);
 
   if (multiprocessing::context().nbProcs() == 1)
     std::cout << " scenario: " << scenario->getId() << " - final status: " << getStatusAsString(status) << "\n" << std::endl;
@@ -223,13 +525,64 @@ CriticalTimeLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario
   return criticalTimeResult;
 }
 
+double
+CriticalTimeLauncher::computeFailureIndicator(const SimulationResult& result, double tEnd) const {
+  if (result.getStatus() != CRITERIA_NON_RESPECTED_STATUS || result.getFailingCriteria().empty())
+    return -1.;
+  double failureTime = std::numeric_limits<double>::max();
+  for (const auto& criteria : result.getFailingCriteria())
+    failureTime = std::min(failureTime, criteria.first);
+  if (!DYN::doubleGreater(failureTime, tEnd))
+    return -1.;  // failure before the clearing of the fault
+  return 1. / (failureTime - tEnd);
+}
+
+double
+CriticalTimeLauncher::interpolateCriticalTime(const std::map<double, double>& failureIndicators, double tHighestSuccess, double tLowestFailed,
+    double accuracy) {
+  if (failureIndicators.size() < 2)
+    return -1.;
+  auto lowest = failureIndicators.begin();
+  auto next = std::next(lowest);
+  // the indicator must decrease towards zero when the clearing time gets closer to the critical time
+  if (!DYN::doubleGreater(next->second, lowest->second))
+    return -1.;
+  const double slope = (next->second - lowest->second) / (next->first - lowest->first);
+  const double tInterpolated = round(lowest->first - lowest->second / slope, accuracy);
+  if (!DYN::doubleGreater(tInterpolated, round(tHighestSuccess, accuracy)) || !DYN::doubleGreater(round(tLowestFailed, accuracy), tInterpolated))
+    return -1.;
+  return tInterpolated;
+}
+
+double
+CriticalTimeLauncher::computeTimeAfterDivergence(double tMax, double tHighestSuccess, double& tLowestFailed, double& divergenceStep,
+    double accuracy) const {
+  // In case of solver issue, tMax become the previous lowest time with an issue minus the accuracy.
+  // A solver issue confirmed at this time makes it the lowest time with an issue and the step is doubled,
+  // so that a series of solver issues stays logarithmic
+  if (divergenceStep > 0. && DYN::doubleEquals(tMax, tLowestFailed - divergenceStep)) {
+    tLowestFailed = tMax;
+    divergenceStep *= 2.;
+  } else {
+    divergenceStep = accuracy;
+  }
+  double tNext = tLowestFailed - divergenceStep;
+  // the step never goes below the middle of the range: the region with solver issues is then bisected
+  const double tMiddle = (tHighestSuccess + tLowestFailed) / 2.;
+  if (tNext < tMiddle) {
+    tNext = tMiddle;
+    divergenceStep = tLowestFailed - tNext;
+  }
+  return tNext;
+}
+
 status_t
-CriticalTimeLauncher::getFinalStatus(int nbSimulationsDone, int nbSimulationsFailed) const {
+CriticalTimeLauncher::getFinalStatus(int nbSimulationsDone, int nbSimulationsFailed, bool maxValueSucceeded) const {
   if (nbSimulationsDone == nbSimulationsFailed) {
     // Check if all simulations failed (if yes, min range might be the problem)
     return DYNAlgorithms::CT_BELOW_MIN_BOUND_STATUS;
-  } else if (nbSimulationsDone == 1) {
-    // If the first one succeed, max range might be the problem
+  } else if (maxValueSucceeded) {
+    // If the max value succeed, max range might be the problem
     return DYNAlgorithms::CT_ABOVE_MAX_BOUND_STATUS;
   } else {
     return DYNAlgorithms::RESULT_FOUND_STATUS;
@@ -249,6 +602,8 @@ CriticalTimeLauncher::exportCTCResult(const CriticalTimeResult& result) const {
 
   file << "criticalTime:" << result.getCriticicalTime() << std::endl;
   file << "calculationStatus:" << static_cast<unsigned int>(result.getStatus()) << std::endl;
+  file << "instabilityTime:" << result.getInstabilityTime() << std::endl;
+  file << "instabilityReason:" << result.getInstabilityReason() << std::endl;
 }
 
 CriticalTimeResult
@@ -303,6 +658,18 @@ CriticalTimeLauncher::importCTCResult(const std::string& id) const {
   ss >> calculationStatus;
   result.setStatus(static_cast<status_t>(calculationStatus));
 
+  // Instability
+  double instabilityTime;
+  file >> tmpStr;
+  assert(tmpStr.find("instabilityTime:") == 0);
+  tmpStr = tmpStr.substr(tmpStr.find(delimiter)+1);
+  ss.clear();
+  ss.str(tmpStr);
+  ss >> instabilityTime;
+  file >> tmpStr;
+  assert(tmpStr.find("instabilityReason:") == 0);
+  result.setInstability(instabilityTime, tmpStr.substr(tmpStr.find(delimiter)+1));
+
   return result;
 }
 
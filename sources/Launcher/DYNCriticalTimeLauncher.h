@@ -23,6 +23,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 #include <DYNCommon.h>
 #include "DYNRobustnessAnalysisLauncher.h"
@@ -50,9 +51,11 @@ class CriticalTimeLauncher : public RobustnessAnalysisLauncher {
    * launch the calculation of one scenario
    * @param scenario scenario to launch
    * @param criticalTimeCalculation critical time calculation
+   * @param priorCriticalTime critical time of a scenario of the same group seeding the initial bracket, negative if none
    * @return result of the scenario
    */
-  CriticalTimeResult launchScenario(const boost::shared_ptr<Scenario>& scenario, std::shared_ptr<CriticalTimeCalculation> criticalTimeCalculation);
+  CriticalTimeResult launchScenario(const boost::shared_ptr<Scenario>& scenario, std::shared_ptr<CriticalTimeCalculation> criticalTimeCalculation,
+      double priorCriticalTime = -1.);
 
   /**
    * @brief Launch the simulation with the new value calculted in the critical time algorithm
@@ -77,9 +80,10 @@ class CriticalTimeLauncher : public RobustnessAnalysisLauncher {
    * @brief get the status of the Calculation according to the number of simulation done and the ones failed
    * @param nbSimulationsDone number of simulation Done
    * @param nbSimulationsFailed number of simulation Failed
+   * @param maxValueSucceeded whether the simulation clearing the fault at the max value succeeded
    * @return status of the calculation
    */
-  status_t getFinalStatus(int nbSimulationsDone, int nbSimulationsFailed) const;
+  status_t getFinalStatus(int nbSimulationsDone, int nbSimulationsFailed, bool maxValueSucceeded) const;
 
   /**
    * @brief Export a save result file
@@ -95,6 +99,64 @@ class CriticalTimeLauncher : public RobustnessAnalysisLauncher {
   CriticalTimeResult importCTCResult(const std::string& id) const;
 
  protected:
+  /**
+   * @brief Compute the name of the state files of the fault-on trajectory at a time
+   * @param time time of the state
+   * @return name of the state files, without extension
+   */
+  std::string computeFaultOnStateName(double time) const;
+
+  /**
+   * @brief Compute the checkpoints of the fault-on trajectory
+   *
+   * The checkpoints are the clearing times tested by the first levels of the dichotomy between the bounds of the research,
+   * rounded to its accuracy
+   *
+   * @param minValue lower bound of the research
+   * @param maxValue upper bound of the research
+   * @param accuracy accuracy of the research
+   * @return the checkpoints strictly between the bounds, in increasing order
+   */
+  std::vector<double> computeFaultOnCheckpoints(double minValue, double maxValue, double accuracy);
+
+  /**
+   * @brief Compute the stability indicator of a failed simulation
+   *
+   * @param result result of the simulation
+   * @param tEnd clearing time of the simulation
+   * @return inverse of the time between the clearing and the first non-respected criteria,
+   * negative if unknown or if the simulation did not fail on a criteria
+   */
+  double computeFailureIndicator(const SimulationResult& result, double tEnd) const;
+
+  /**
+   * @brief Interpolate the critical time from the stability indicators of the failed simulations
+   *
+   * The indicators of the two lowest failed clearing times are extrapolated linearly to the clearing time where they vanish
+   *
+   * @param failureIndicators stability indicators of the failed simulations, by clearing time
+   * @param tHighestSuccess max time where all times lower lead to a succeeded simulation
+   * @param tLowestFailed min time where all times higher lead to a failed simulation
+   * @param accuracy accuracy of the calculation
+   * @return clearing time to test, strictly inside the range, negative if the indicators are uninformative
+   */
+  double interpolateCriticalTime(const std::map<double, double>& failureIndicators, double tHighestSuccess, double tLowestFailed, double accuracy);
+
+  /**
+   * @brief Compute the clearing time to test after a solver issue in the COMPLEX mode
+   *
+   * The time tested is below the lowest failed time by a step doubled each time a solver issue is confirmed at the previous step,
+   * the step never going below the middle of the range
+   *
+   * @param tMax clearing time whose simulation had a solver issue
+   * @param tHighestSuccess max time where all times lower lead to a succeeded simulation
+   * @param tLowestFailed min time where all times higher lead to a failed simulation, lowered to tMax when the solver issue confirms the step
+   * @param divergenceStep distance below tLowestFailed of the time tested after the previous solver issue, 0 if none, set to the new step
+   * @param accuracy accuracy of the calculation
+   * @return clearing time to test
+   */
+  double computeTimeAfterDivergence(double tMax, double tHighestSuccess, double& tLowestFailed, double& divergenceStep, double accuracy) const;
+
   std::vector<CriticalTimeResult> results_;  ///< results of all scenarios of the critical time calculation
 
  private:
@@ -104,6 +166,128 @@ class CriticalTimeLauncher : public RobustnessAnalysisLauncher {
    * @param zipIt true if we want to fill mapData to create a zip, false if we want to write the files on the disk
    */
   void createOutputs(std::map<std::string, std::string>& mapData, bool zipIt) const;
+
+  /**
+   * @brief Simulate the base situation until the pre-fault time and dump its final state to share it with all the simulations
+   *
+   * The simulation is done by the root process, the other processes read the dumped state from the working directory
+   *
+   * @param baseJobsFile jobs file of the base situation
+   * @param preFaultTime stop time of the simulation, before the fault inception
+   */
+  void launchPreFaultSimulation(const std::string& baseJobsFile, double preFaultTime);
+
+  /**
+   * @brief Critical value research of a parameter for a scenario
+   */
+  struct Research {
+    boost::shared_ptr<Scenario> scenario_;  ///< scenario, with the id and the dyd id of the research
+    std::shared_ptr<CriticalTimeCalculation> criticalTimeCalculation_;  ///< calculation with the parameter and the bounds of the research
+  };
+
+  /**
+   * @brief List the independent researches of the calculation
+   *
+   * Without target, there is one research per scenario. Otherwise, there is one research per scenario and target, identified by
+   * the id of the scenario followed by the id of the target
+   *
+   * @param criticalTimeCalculation critical time calculation
+   * @return researches to launch
+   */
+  std::vector<Research> listResearches(const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation) const;
+
+  /**
+   * @brief Launch the researches, the leader of each group of researches first
+   *
+   * The first research of each group (given by the group of its scenario, or by its dydId if none) leads it: the leaders are launched first,
+   * then the critical value found by a leader seeds the initial bracket of the other researches of its group
+   *
+   * @param researches researches to launch
+   */
+  void launchResearchesWithPriors(const std::vector<Research>& researches);
+
+  /**
+   * @brief State from which the simulations of a scenario start
+   */
+  struct SimulationStart {
+    /// @brief default constructor: start of the jobs file
+    SimulationStart() : time_(-1.) {}
+
+    double time_;  ///< start time, negative to use the one of the jobs file
+    std::string stateFile_;  ///< state to start from, empty to use the one of the jobs file
+    std::string iidmFile_;  ///< network to start from
+    MultiVariantInputs inputs_;  ///< inputs of the simulations starting from this state
+  };
+
+  /**
+   * @brief Launch a simulation of a scenario from a given state
+   *
+   * @param workingDir working directory
+   * @param criticalTimeCalculation critical time calculation
+   * @param scenario scenario to launch
+   * @param start state to start from
+   * @param faultEnd end of the fault in the simulation
+   * @param params simulation parameters, completed with the start state
+   * @param result result of the simulation
+   * @param retainOutputs whether the outputs of the simulation are printed in the result
+   */
+  void launchFaultSimulation(const std::string& workingDir, const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation,
+    const boost::shared_ptr<Scenario>& scenario, const SimulationStart& start, double faultEnd, SimulationParameters& params, SimulationResult& result,
+    bool retainOutputs = true);
+
+  /**
+   * @brief Find the state of the fault-on trajectory of the current scenario at a clearing time or simulate it
+   *
+   * The fault-on trajectory is simulated from the latest state already dumped before the clearing time and dumped at the clearing time.
+   * The checkpoints crossed on the way are dumped too, in increasing order: as the dichotomy tests the highest clearing times first,
+   * the fault-on trajectory is then simulated once and each later clearing time only needs the segment from the checkpoint before it
+   *
+   * @param workingDir working directory
+   * @param criticalTimeCalculation critical time calculation
+   * @param scenario scenario to launch
+   * @param tEnd clearing time
+   * @param result filled with the failure of the fault-on trajectory if it fails before the clearing time
+   * @return the state at the clearing time, null if the fault-on trajectory fails before it
+   */
+  const SimulationStart* findOrLaunchFaultOnState(const std::string& workingDir, const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation,
+    const boost::shared_ptr<Scenario>& scenario, double tEnd, SimulationResult& result);
+
+  /**
+   * @brief Simulate the fault-on trajectory of the current scenario from the latest state dumped before a time and dump its state at this time
+   *
+   * @param workingDir working directory
+   * @param criticalTimeCalculation critical time calculation
+   * @param scenario scenario to launch
+   * @param tEnd time of the dumped state
+   * @param result filled with the failure of the fault-on trajectory if it fails before tEnd
+   * @return the state at tEnd, null if the fault-on trajectory fails before it
+   */
+  const SimulationStart* launchFaultOnSegment(const std::string& workingDir, const std::shared_ptr<CriticalTimeCalculation>& criticalTimeCalculation,
+    const boost::shared_ptr<Scenario>& scenario, double tEnd, SimulationResult& result);
+
+ private:
+  /**
+   * @brief double comparison with tolerance
+   */
+  struct dynawoDoubleLess {
+    /**
+     * @brief double comparison with tolerance
+     * @param left first real to compare
+     * @param right second real to compare
+     * @return true if left < right
+     */
+    bool operator() (const double left, const double right) const {
+      return !DYN::doubleEquals(left, right) && left < right;
+    }
+  };
+
+  std::string baseJobsFile_;  ///< jobs file of the base situation
+  SimulationStart initialStart_;  ///< state from which the simulations start, the pre-fault state if any
+  std::map<double, SimulationStart, dynawoDoubleLess> faultOnStates_;  ///< states of the fault-on trajectory of the current scenario, by clearing time
+  SimulationResult faultOnFailure_;  ///< failure of the fault-on trajectory of the current scenario, if any
+  double faultOnFailureTime_;  ///< time before which the fault-on trajectory of the current scenario fails, negative if it did not fail
+
+  static constexpr unsigned int faultOnCheckpointsLevels_ = 3;  ///< number of levels of the dichotomy whose clearing times are checkpoints
 };
 }  // namespace DYNAlgorithms
 
@@ -22,6 +22,8 @@
 #include <cmath>
 #include <ctime>
 #include <iomanip>
+#include <algorithm>
+#include <set>
 
 #include "boost/date_time/posix_time/posix_time.hpp"
 
@@ -53,6 +55,7 @@
 #include "MacrosMessage.h"
 #include "DYNScenarios.h"
 #include "DYNAggrResXmlExporter.h"
+#include "DYNAggrResXmlImporter.h"
 #include "DYNMultiProcessingContext.h"
 
 using DYN::Trace;
@@ -65,6 +68,29 @@ static DYN::TraceStream TraceInfo(const std::string& tag = "") {
   return multiprocessing::context().isRootProc() ? Trace::info(tag) : DYN::TraceStream();
 }
 
+/**
+ * @brief Check if the scenarios of a load level were launched
+ * @param loadIncreaseResult results of the load level
+ * @return false if the load increase of the level succeeded and some of its scenarios are still to be launched, true otherwise
+ */
+static bool
+areScenariosLaunched(const LoadIncreaseResult& loadIncreaseResult) {
+  if (!loadIncreaseResult.getResult().getSuccess())
+    return true;
+  for (const SimulationResult& scenarioResult : loadIncreaseResult.getScenariosResults()) {
+    if (scenarioResult.getScenarioId().empty())
+      return false;
+  }
+  return true;
+}
+
+MarginCalculationLauncher::MarginCalculationLauncher() :
+tLoadIncrease_(0.),
+tScenario_(0.),
+screening_(false),
+activeLevelSelection_(false) {
+}
+
 void
 MarginCalculationLauncher::createScenarioWorkingDir(const std::string& scenarioId, double variation) const {
   std::stringstream subDir;
@@ -78,18 +104,33 @@ MarginCalculationLauncher::createScenarioWorkingDir(const std::string& scenarioI
 
 
 void
-MarginCalculationLauncher::cleanResultDirectories(const std::vector<boost::shared_ptr<Scenario> >& events) const {
+MarginCalculationLauncher::cleanResultDirectories(const std::vector<boost::shared_ptr<Scenario> >& events) {
   multiprocessing::Context::sync();
+  if (multiprocessing::context().isRootProc())
+    retainExportedOutputs();
+  collectLoadIncreaseStates(std::vector<std::pair<double, double> >());
   for (const auto& loadIncrease : loadIncreaseStatus_) {
     cleanResult(computeLoadIncreaseScenarioId(loadIncrease.first));
   }
   for (const auto& loadLevel : scenarioStatus_) {
     for (const auto& scenario : events) {
-      cleanResult(SimulationResult::getUniqueScenarioId(scenario->getId(), loadLevel.first));
+      cleanResult(SimulationResult::getUniqueScenarioId(computeScenarioId(scenario->getId()), loadLevel.first));
     }
   }
 }
 
+void
+MarginCalculationLauncher::resetResearch(size_t nbScenarios) {
+  // the state of the research is specific to each load increase
+  loadIncreaseStatus_.clear();
+  sequentialLoadIncreaseResults_.clear();
+  scenarioStatus_.clear();
+  collectedLoadIncreaseLevels_.clear();
+  inputsByIIDM_.clear();
+  previousMargins_.clear();
+  scenarioBounds_.assign(nbScenarios, ScenarioBounds());
+}
+
 void
 MarginCalculationLauncher::readTimes(const std::string& jobFileLoadIncrease, const std::string& jobFileScenario) {
   // job
@@ -107,22 +148,44 @@ MarginCalculationLauncher::readTimes(const std::string& jobFileLoadIncrease, con
 void
 MarginCalculationLauncher::launch() {
   assert(multipleJobs_);
-  boost::posix_time::ptime t0 = boost::posix_time::second_clock::local_time();
   results_.clear();
   boost::shared_ptr<MarginCalculation> marginCalculation = multipleJobs_->getMarginCalculation();
   if (!marginCalculation) {
     throw DYNAlgorithmsError(MarginCalculationTaskNotFound);
   }
-  const boost::shared_ptr<LoadIncrease>& loadIncrease = marginCalculation->getLoadIncrease();
   const boost::shared_ptr<Scenarios>& scenarios = marginCalculation->getScenarios();
   if (!scenarios) {
     throw DYNAlgorithmsError(SystematicAnalysisTaskNotFound);
   }
+  steadyStateDetection_ = scenarios->getSteadyStateDetection();
+
+  // the margins of the load increases are computed one after the other in the same run:
+  // the parsed inputs and the event models found in the scenarios are shared
+  const std::vector<boost::shared_ptr<LoadIncrease> >& loadIncreases = marginCalculation->getLoadIncreases();
+  for (const auto& loadIncrease : loadIncreases) {
+    loadIncreaseDirection_ = loadIncreases.size() > 1 ? loadIncrease->getId() : "";
+    if (!loadIncreaseDirection_.empty())
+      TraceInfo(logTag_) << DYNAlgorithmsLog(LoadIncreaseDirection, loadIncreaseDirection_) << Trace::endline;
+    const size_t firstResultIndex = results_.size();
+    computeMargin(marginCalculation, loadIncrease);
+    for (size_t i = firstResultIndex; i < results_.size(); ++i)
+      results_[i].setLoadIncreaseId(loadIncreaseDirection_);
+  }
+}
+
+void
+MarginCalculationLauncher::computeMargin(const boost::shared_ptr<MarginCalculation>& marginCalculation,
+    const boost::shared_ptr<LoadIncrease>& loadIncrease) {
+  boost::posix_time::ptime t0 = boost::posix_time::second_clock::local_time();
+  const boost::shared_ptr<Scenarios>& scenarios = marginCalculation->getScenarios();
   const std::string& baseJobsFile = scenarios->getJobsFile();
   const std::vector<boost::shared_ptr<Scenario> >& events = scenarios->getScenarios();
+  resetResearch(events.size());
+  activeLevelSelection_ = marginCalculation->getLevelSelection() == MarginCalculation::ACTIVE_LEARNING;
 
   // Retrieve from jobs file tLoadIncrease and tScenario
   readTimes(loadIncrease->getJobsFile(), baseJobsFile);
+  writeScenariosEventsFiles(events);
 
   double maxVariation = 100.;
   double minVariation = 0.;
@@ -156,7 +219,6 @@ MarginCalculationLauncher::launch() {
   // step one : launch the loadIncrease and then all events with 100% of the load increase
   // if there is no crash => no need to go further
   // We start with 100% as it is the most common result of margin calculations on real large cases
-  std::vector<double > maximumVariationPassing(events.size(), 0.);
   const size_t maxLoadIncreaseVariationIndex = results_.size() - 1;
   if (results_.at(maxLoadIncreaseVariationIndex).getResult().getSuccess()) {
     if (!DYN::doubleEquals(minVariation, maxVariation))
@@ -165,15 +227,10 @@ MarginCalculationLauncher::launch() {
 
     // analyze results
     unsigned int nbSuccess = 0;
-    size_t id = 0;
-    for (auto simulationResultIt = results_.at(maxLoadIncreaseVariationIndex).getScenariosResults().cbegin();
-          simulationResultIt != results_.at(maxLoadIncreaseVariationIndex).getScenariosResults().cend(); ++simulationResultIt, ++id) {
-      TraceInfo(logTag_) << DYNAlgorithmsLog(ScenariosEnd, simulationResultIt->getUniqueScenarioId(),
-                                                  getStatusAsString(simulationResultIt->getStatus())) << Trace::endline;
-      if (simulationResultIt->getStatus() == CONVERGENCE_STATUS) {  // event OK
+    for (const auto& result : results_.at(maxLoadIncreaseVariationIndex).getScenariosResults()) {
+      TraceInfo(logTag_) << DYNAlgorithmsLog(ScenariosEnd, result.getUniqueScenarioId(), getStatusAsString(result.getStatus())) << Trace::endline;
+      if (result.getStatus() == CONVERGENCE_STATUS)  // event OK
         nbSuccess++;
-        maximumVariationPassing[id] = maxVariation;
-      }
     }
     if (nbSuccess == events.size() &&
       ((100. - maxVariation) < marginCalculation->getAccuracy() ||
@@ -212,9 +269,17 @@ MarginCalculationLauncher::launch() {
   maxVariation = 100.;
   minVariation = 0.;
 
-  if (marginCalculation->getCalculationType() == MarginCalculation::GLOBAL_MARGIN || events.size() == 1) {
-    double value = computeGlobalMargin(loadIncrease, baseJobsFile, events, maximumVariationPassing,
-                                       marginCalculation->getAccuracy(), minVariation, maxVariation);
+  const bool globalMargin = marginCalculation->getCalculationType() == MarginCalculation::GLOBAL_MARGIN || events.size() == 1;
+  if (marginCalculation->getScreeningDuration() > 0.) {
+    screenMargins(loadIncrease, baseJobsFile, events, marginCalculation->getAccuracy(), marginCalculation->getScreeningDuration(), globalMargin);
+    launchPreviousMarginsBrackets(loadIncrease, baseJobsFile, events, marginCalculation->getAccuracy(), globalMargin);
+  } else if (!marginCalculation->getPreviousResultsFile().empty()) {
+    readPreviousMargins(marginCalculation->getPreviousResultsFile(), events);
+    launchPreviousMarginsBrackets(loadIncrease, baseJobsFile, events, marginCalculation->getAccuracy(), globalMargin);
+  }
+
+  if (globalMargin) {
+    double value = computeGlobalMargin(loadIncrease, baseJobsFile, events, marginCalculation->getAccuracy(), minVariation, maxVariation);
     if (value < marginCalculation->getAccuracy()) {
       // step two : launch the loadIncrease and then all events with 0% of the load increase
       // if one event crash => no need to go further
@@ -231,14 +296,11 @@ MarginCalculationLauncher::launch() {
         toRun = std::queue< task_t >();
         std::vector<size_t> eventsIds;
         for (size_t i = 0; i < events.size() ; ++i) {
-          if (variation0 > maximumVariationPassing[i] || DYN::doubleEquals(variation0, maximumVariationPassing[i])) {
+          if (!isScenarioDecided(i, variation0)) {
             eventsIds.push_back(i);
           } else {
             TraceInfo(logTag_) << DYNAlgorithmsLog(ScenarioNotSimulated, events[i]->getId()) << Trace::endline;
-            results_.at(globalMarginMinLoadLevelIndex).getScenarioResult(i).setScenarioId(events[i]->getId());
-            results_.at(globalMarginMinLoadLevelIndex).getScenarioResult(i).setVariation(minVariation);
-            results_.at(globalMarginMinLoadLevelIndex).getScenarioResult(i).setSuccess(true);
-            results_.at(globalMarginMinLoadLevelIndex).getScenarioResult(i).setStatus(CONVERGENCE_STATUS);
+            fillDecidedScenarioResult(i, events[i]->getId(), variation0, results_.at(globalMarginMinLoadLevelIndex).getScenarioResult(i));
           }
         }
         toRun.emplace(task_t(0., 0., eventsIds));
@@ -328,10 +390,51 @@ MarginCalculationLauncher::launch() {
 double
 MarginCalculationLauncher::computeGlobalMargin(const boost::shared_ptr<LoadIncrease>& loadIncrease,
     const std::string& baseJobsFile, const std::vector<boost::shared_ptr<Scenario> >& events,
-    std::vector<double >& maximumVariationPassing, double tolerance, double minVariation, double maxVariation) {
+    double tolerance, double minVariation, double maxVariation) {
+  // start from the bracket given by what is already known: all scenarios pass below the lowest known pass,
+  // the load increase or one scenario fails above the lowest known failure
+  double knownPass = events.empty() ? minVariation : maxVariation;
+  double knownFail = maxVariation;
+  for (const auto& bounds : scenarioBounds_) {
+    knownPass = std::min(knownPass, bounds.knownPass_);
+    knownFail = std::min(knownFail, bounds.knownFail_);
+  }
+  for (const auto& status : loadIncreaseStatus_) {
+    if (!status.second.success)
+      knownFail = std::min(knownFail, status.first);
+  }
+  // the final state of the lowest level is kept as the scenarios may be launched on it at the end of the research
+  const double lowestVariation = minVariation;
+  if (knownPass > minVariation && knownPass < maxVariation)
+    minVariation = knownPass;
+  if (knownFail < maxVariation && knownFail > minVariation)
+    maxVariation = knownFail;
 
   while ( maxVariation - minVariation > tolerance ) {
     double newVariation = round((minVariation + maxVariation)/2.);
+    // the level fails if one scenario is already known to fail for this variation and all scenarios pass if they are all known to pass
+    bool allKnownToPass = !events.empty();
+    bool oneKnownToFail = false;
+    for (size_t i = 0; i < events.size(); ++i) {
+      if (isScenarioKnownToFail(i, newVariation)) {
+        TraceInfo(logTag_) << DYNAlgorithmsLog(VariationKnownToFail, newVariation, events[i]->getId()) << Trace::endline;
+        oneKnownToFail = true;
+        break;
+      }
+      if (!isScenarioDecided(i, newVariation))
+        allKnownToPass = false;
+    }
+    if (oneKnownToFail) {
+      recordDecidedLoadLevel(events, newVariation);
+      maxVariation = newVariation;
+      continue;
+    } else if (allKnownToPass) {
+      TraceInfo(logTag_) << DYNAlgorithmsLog(VariationAlreadyDecided, newVariation) << Trace::endline;
+      recordDecidedLoadLevel(events, newVariation);
+      minVariation = newVariation;
+      continue;
+    }
+
     results_.emplace_back(events.size());
     const size_t loadIncreaseIndex = results_.size() - 1;
     findOrLaunchLoadIncrease(loadIncrease, newVariation, minVariation, maxVariation, tolerance, results_.at(loadIncreaseIndex));
@@ -343,14 +446,13 @@ MarginCalculationLauncher::computeGlobalMargin(const boost::shared_ptr<LoadIncre
     if (results_.at(loadIncreaseIndex).getResult().getSuccess()) {
       std::queue< task_t > toRun;
       std::vector<size_t> eventsIds;
+      std::vector<bool> decided(events.size(), false);
       for (size_t i=0; i < events.size() ; ++i) {
-        if (newVariation > maximumVariationPassing[i]) {
+        if (!isScenarioDecided(i, newVariation)) {
           eventsIds.push_back(i);
         } else {
-          results_.at(loadIncreaseIndex).getScenarioResult(i).setScenarioId(events[i]->getId());
-          results_.at(loadIncreaseIndex).getScenarioResult(i).setVariation(newVariation);
-          results_.at(loadIncreaseIndex).getScenarioResult(i).setSuccess(true);
-          results_.at(loadIncreaseIndex).getScenarioResult(i).setStatus(CONVERGENCE_STATUS);
+          decided[i] = true;
+          fillDecidedScenarioResult(i, events[i]->getId(), newVariation, results_.at(loadIncreaseIndex).getScenarioResult(i));
         }
       }
       findAllLevelsBetween(minVariation, maxVariation, tolerance, eventsIds, toRun);
@@ -360,17 +462,13 @@ MarginCalculationLauncher::computeGlobalMargin(const boost::shared_ptr<LoadIncre
       unsigned int nbSuccess = 0;
       size_t id = 0;
       for (const auto& result : results_.at(loadIncreaseIndex).getScenariosResults()) {
-        if (newVariation < maximumVariationPassing[id] || DYN::doubleEquals(newVariation, maximumVariationPassing[id]))
+        if (decided[id])
           TraceInfo(logTag_) << DYNAlgorithmsLog(ScenarioNotSimulated, result.getUniqueScenarioId()) << Trace::endline;
         else
           TraceInfo(logTag_) << DYNAlgorithmsLog(ScenariosEnd,
               result.getUniqueScenarioId(), getStatusAsString(result.getStatus())) << Trace::endline;
-        if (result.getStatus() == CONVERGENCE_STATUS || newVariation < maximumVariationPassing[id] ||
-          DYN::doubleEquals(newVariation, maximumVariationPassing[id])) {  // event OK
+        if (result.getStatus() == CONVERGENCE_STATUS)  // event OK
           nbSuccess++;
-          if (newVariation > maximumVariationPassing[id])
-            maximumVariationPassing[id] = newVariation;
-        }
         ++id;
       }
       if (nbSuccess == events.size() )  // all events succeed
@@ -380,6 +478,10 @@ MarginCalculationLauncher::computeGlobalMargin(const boost::shared_ptr<LoadIncre
     } else {
       maxVariation = newVariation;  // load increase crashed
     }
+    std::vector<std::pair<double, double> > activeBrackets;
+    activeBrackets.push_back(std::make_pair(lowestVariation, lowestVariation));
+    activeBrackets.push_back(std::make_pair(minVariation, maxVariation));
+    collectLoadIncreaseStates(activeBrackets);
     TraceInfo(logTag_) << Trace::endline;
   }
   return minVariation;
@@ -409,7 +511,13 @@ MarginCalculationLauncher::findAllLevelsBetween(const double minVariation, const
     double nextVar = round((min + max)/2.);
     auto it = loadIncreaseStatus_.find(nextVar);
     if (it == loadIncreaseStatus_.end() || !it->second.success) continue;
-    toRun.emplace(task_t(min, max, eventIdxs));
+    std::vector<size_t> undecidedIdxs;
+    for (const auto eventIdx : eventIdxs) {
+      if (!isScenarioDecided(eventIdx, nextVar))
+        undecidedIdxs.push_back(eventIdx);
+    }
+    if (!undecidedIdxs.empty())
+      toRun.emplace(task_t(min, max, undecidedIdxs));
     if (max - nextVar > tolerance)
       minMaxStack.emplace(std::make_pair(nextVar, max));
     if (nextVar - min > tolerance)
@@ -422,18 +530,72 @@ MarginCalculationLauncher::computeLocalMargin(const boost::shared_ptr<LoadIncrea
     const std::string& baseJobsFile, const std::vector<boost::shared_ptr<Scenario> >& events, const double tolerance, const double minVariation,
     const double maxVariation, std::vector<double>& results) {
   double maxLoadVarForLoadIncrease = 0.;
+  double loadIncreaseKnownFail = maxVariation;
+  for (const auto& status : loadIncreaseStatus_) {
+    if (!status.second.success)
+      loadIncreaseKnownFail = std::min(loadIncreaseKnownFail, status.first);
+  }
+  // scenarios are grouped by the bracket given by their known bounds
+  std::map<std::pair<double, double>, std::vector<size_t> > brackets;
+  for (size_t i=0; i < events.size() ; ++i) {
+    const ScenarioBounds& bounds = scenarioBounds_.at(i);
+    const double min = std::max(minVariation, bounds.knownPass_);
+    const double max = std::min(loadIncreaseKnownFail, bounds.knownFail_);
+    if (bounds.knownPass_ > results[i])
+      results[i] = bounds.knownPass_;
+    if (max - min > tolerance)
+      brackets[std::make_pair(min, max)].push_back(i);
+  }
   std::queue< task_t > toRun;
-  std::vector<size_t> all;
-  for (size_t i=0; i < events.size() ; ++i)
-    all.push_back(i);
-  toRun.emplace(task_t(0., 100., all));
+  auto pushTask = [this, &toRun](task_t& task) {
+    if (activeLevelSelection_)
+      task.variation_ = selectTaskVariation(task);
+    toRun.push(task);
+  };
+  for (const auto& bracket : brackets) {
+    task_t task(bracket.first.first, bracket.first.second, bracket.second);
+    pushTask(task);
+  }
 
   while (!toRun.empty()) {
     std::queue< task_t > toRunCopy(toRun);  // Needed as findOrLaunchScenarios modifies the queue
     task_t task = toRun.front();
     toRun.pop();
     const std::vector<size_t>& eventsId = task.ids_;
-    double newVariation = round((task.minVariation_ + task.maxVariation_)/2.);
+    double newVariation = task.variation_;
+
+    // no simulation at all if the status of every scenario of the task is already known for this variation
+    bool allDecided = !eventsId.empty();
+    for (const auto eventId : eventsId) {
+      if (!isScenarioDecided(eventId, newVariation)) {
+        allDecided = false;
+        break;
+      }
+    }
+    if (allDecided) {
+      TraceInfo(logTag_) << DYNAlgorithmsLog(VariationAlreadyDecided, newVariation) << Trace::endline;
+      task_t below(task.minVariation_, newVariation);
+      task_t above(newVariation, task.maxVariation_);
+      for (const auto eventId : eventsId) {
+        if (isScenarioKnownToFail(eventId, newVariation)) {
+          if ( newVariation - task.minVariation_ > tolerance )
+            below.ids_.push_back(eventId);
+        } else {
+          if (maxLoadVarForLoadIncrease < newVariation)
+            maxLoadVarForLoadIncrease = newVariation;
+          if (results[eventId] < newVariation)
+            results[eventId] = newVariation;
+          if ( task.maxVariation_ - newVariation > tolerance )
+            above.ids_.push_back(eventId);
+        }
+      }
+      if (!below.ids_.empty())
+        pushTask(below);
+      if (!above.ids_.empty())
+        pushTask(above);
+      continue;
+    }
+
     results_.emplace_back(eventsId.size());
     const size_t loadIncreaseIndex = results_.size() - 1;
     findOrLaunchLoadIncrease(loadIncrease, newVariation, minVariation, maxVariation, tolerance, results_.at(loadIncreaseIndex));
@@ -470,22 +632,153 @@ MarginCalculationLauncher::computeLocalMargin(const boost::shared_ptr<LoadIncrea
         }
       }
       if (!below.ids_.empty())
-        toRun.push(below);
+        pushTask(below);
       if (!above.ids_.empty())
-        toRun.push(above);
+        pushTask(above);
     } else if ( newVariation - task.minVariation_ > tolerance ) {
       task_t below(task.minVariation_, newVariation);
       for (const auto eventId : eventsId) {
         below.ids_.push_back(eventId);
       }
       if (!below.ids_.empty())
-        toRun.push(below);
+        pushTask(below);
     }
+    std::vector<std::pair<double, double> > activeBrackets;
+    activeBrackets.push_back(std::make_pair(minVariation, minVariation));
+    for (std::queue< task_t > pending(toRun); !pending.empty(); pending.pop())
+      activeBrackets.push_back(std::make_pair(pending.front().minVariation_, pending.front().maxVariation_));
+    collectLoadIncreaseStates(activeBrackets);
     TraceInfo(logTag_) << Trace::endline;
   }
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (scenarioBounds_.at(i).knownPass_ > results[i])
+      results[i] = scenarioBounds_.at(i).knownPass_;
+  }
+  for (const auto& status : loadIncreaseStatus_) {
+    if (status.second.success && status.first > maxLoadVarForLoadIncrease)
+      maxLoadVarForLoadIncrease = status.first;
+  }
   return maxLoadVarForLoadIncrease;
 }
 
+void
+MarginCalculationLauncher::readPreviousMargins(const std::string& previousResultsFile, const std::vector<boost::shared_ptr<Scenario> >& events) {
+  aggregatedResults::XmlImporter importer;
+  const std::vector<LoadIncreaseResult> previousResults =
+      importer.importLoadIncreaseResultsFromFile(createAbsolutePath(previousResultsFile, workingDirectory_));
+
+  std::map<std::string, size_t> eventsIdx;
+  for (size_t i = 0; i < events.size(); ++i)
+    eventsIdx[computeDirectionId(events[i]->getId())] = i;
+
+  // the previous margin of a scenario is the highest load level for which it passed
+  previousMargins_.assign(events.size(), -1.);
+  for (const auto& previousResult : previousResults) {
+    if (previousResult.isScreening() || previousResult.isDecided() || previousResult.getResult().getStatus() != CONVERGENCE_STATUS)
+      continue;
+    const double loadLevel = previousResult.getResult().getVariation();
+    for (const auto& scenarioResult : previousResult.getScenariosResults()) {
+      auto it = eventsIdx.find(scenarioResult.getScenarioId());
+      if (it != eventsIdx.end() && scenarioResult.getStatus() == CONVERGENCE_STATUS && loadLevel > previousMargins_[it->second])
+        previousMargins_[it->second] = loadLevel;
+    }
+  }
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (previousMargins_[i] >= 0.)
+      TraceInfo(logTag_) << DYNAlgorithmsLog(PreviousMarginValueScenario, events[i]->getId(), previousMargins_[i]) << Trace::endline;
+  }
+}
+
+void
+MarginCalculationLauncher::screenMargins(const boost::shared_ptr<LoadIncrease>& loadIncrease, const std::string& baseJobsFile,
+    const std::vector<boost::shared_ptr<Scenario> >& events, double tolerance, double screeningDuration, bool globalMargin) {
+  TraceInfo(logTag_) << DYNAlgorithmsLog(ScreeningStart, screeningDuration) << Trace::endline;
+  // the status of the scenarios already known come from full duration simulations: they are restored after the screening
+  const std::map<double, ScenarioStatus, dynawoDoubleLess> scenarioStatus = scenarioStatus_;
+  const std::vector<ScenarioBounds> scenarioBounds = scenarioBounds_;
+  const double tScenario = tScenario_;
+  scenarioStatus_.clear();
+  tScenario_ = std::min(tScenario_, screeningDuration);
+  screening_ = true;
+
+  const size_t firstScreeningResultIndex = results_.size();
+  std::vector<double> margins(events.size(), 0.);
+  if (globalMargin) {
+    const double globalMarginValue = computeGlobalMargin(loadIncrease, baseJobsFile, events, tolerance, 0., 100.);
+    margins.assign(events.size(), globalMarginValue);
+  } else {
+    computeLocalMargin(loadIncrease, baseJobsFile, events, tolerance, 0., 100., margins);
+  }
+  for (size_t i = firstScreeningResultIndex; i < results_.size(); ++i)
+    results_[i].setScreening(true);
+
+  // the outputs of the screening are never exported
+  multiprocessing::Context::sync();
+  for (const auto& loadLevel : scenarioStatus_) {
+    for (const auto& scenario : events)
+      cleanResult(SimulationResult::getUniqueScenarioId(computeScenarioId(scenario->getId()), loadLevel.first));
+  }
+
+  screening_ = false;
+  tScenario_ = tScenario;
+  scenarioStatus_ = scenarioStatus;
+  scenarioBounds_ = scenarioBounds;
+  previousMargins_ = margins;
+  for (size_t i = 0; i < events.size(); ++i)
+    TraceInfo(logTag_) << DYNAlgorithmsLog(ScreeningMarginValueScenario, events[i]->getId(), previousMargins_[i]) << Trace::endline;
+}
+
+void
+MarginCalculationLauncher::launchPreviousMarginsBrackets(const boost::shared_ptr<LoadIncrease>& loadIncrease,
+    const std::string& baseJobsFile, const std::vector<boost::shared_ptr<Scenario> >& events, double tolerance, bool globalMargin) {
+  double previousGlobalMargin = -1.;
+  for (const auto previousMargin : previousMargins_) {
+    if (previousMargin >= 0. && (previousGlobalMargin < 0. || previousMargin < previousGlobalMargin))
+      previousGlobalMargin = previousMargin;
+  }
+
+  // scenarios to launch by variation: one tolerance below and one tolerance above the previous margin
+  std::map<double, std::vector<size_t>, dynawoDoubleLess> variationsToLaunch;
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (previousMargins_[i] < 0.)
+      continue;
+    const double previousMargin = globalMargin ? previousGlobalMargin : previousMargins_[i];
+    const double below = round(previousMargin - tolerance);
+    const double above = round(previousMargin + tolerance);
+    if (below > 0.)
+      variationsToLaunch[below].push_back(i);
+    if (above < 100.)
+      variationsToLaunch[above].push_back(i);
+  }
+
+  for (const auto& variationToLaunch : variationsToLaunch) {
+    const double variation = variationToLaunch.first;
+    std::vector<size_t> eventsIds;
+    for (const auto eventId : variationToLaunch.second) {
+      if (!isScenarioDecided(eventId, variation))
+        eventsIds.push_back(eventId);
+    }
+    if (eventsIds.empty())
+      continue;
+
+    results_.emplace_back(eventsIds.size());
+    const size_t loadIncreaseIndex = results_.size() - 1;
+    findOrLaunchLoadIncrease(loadIncrease, variation, 0., 100., tolerance, results_.at(loadIncreaseIndex));
+    if (results_.at(loadIncreaseIndex).getResult().getSuccess()) {
+      std::queue< task_t > toRun;
+      toRun.emplace(task_t(variation, variation, eventsIds));
+      LoadIncreaseResult liResultTmp(events.size());
+      findOrLaunchScenarios(baseJobsFile, events, toRun, liResultTmp);
+      for (size_t i = 0; i < eventsIds.size(); ++i) {
+        results_.at(loadIncreaseIndex).getScenarioResult(i) = liResultTmp.getScenarioResult(eventsIds[i]);
+        TraceInfo(logTag_) << DYNAlgorithmsLog(ScenariosEnd, results_.at(loadIncreaseIndex).getScenarioResult(i).getUniqueScenarioId(),
+                                      getStatusAsString(results_.at(loadIncreaseIndex).getScenarioResult(i).getStatus())) << Trace::endline;
+      }
+    }
+    TraceInfo(logTag_) << Trace::endline;
+  }
+}
+
 void MarginCalculationLauncher::findOrLaunchScenarios(const std::string& baseJobsFile,
     const std::vector<boost::shared_ptr<Scenario> >& events,
     std::queue< task_t >& toRun,
@@ -494,70 +787,89 @@ void MarginCalculationLauncher::findOrLaunchScenarios(const std::string& baseJob
   task_t task = toRun.front();
   toRun.pop();
   const std::vector<size_t>& eventsId = task.ids_;
-  double newVariation = round((task.minVariation_ + task.maxVariation_)/2.);
+  double newVariation = task.variation_;
   if (multiprocessing::context().nbProcs() == 1) {
     std::string iidmFile = generateIDMFileNameForVariation(newVariation);
-    if (inputsByIIDM_.count(iidmFile) == 0) {
-      // read inputs only if not already existing with enough variants defined
-      inputsByIIDM_[iidmFile].readInputs(workingDirectory_, baseJobsFile, iidmFile);
+    for (const auto eventId : eventsId) {
+      if (isScenarioDecided(eventId, newVariation)) {
+        fillDecidedScenarioResult(eventId, events[eventId]->getId(), newVariation, result.getScenarioResult(eventId));
+        continue;
+      }
+      if (inputsByIIDM_.count(iidmFile) == 0) {
+        // read inputs only if not already existing with enough variants defined
+        inputsByIIDM_[iidmFile].readInputs(workingDirectory_, baseJobsFile, iidmFile);
+      }
+      SimulationResult& resultScenario = result.getScenarioResult(eventId);
+      launchScenario(inputsByIIDM_[iidmFile], events[eventId], newVariation, resultScenario);
+      scenarioStatus_[newVariation][eventId].success = resultScenario.getSuccess();
+      updateScenarioBounds(eventId, newVariation, resultScenario.getStatus(), computeFailureRatio(resultScenario));
     }
-    for (const auto eventId : eventsId)
-      launchScenario(inputsByIIDM_[iidmFile], events[eventId], newVariation, result.getScenarioResult(eventId));
+    dropSupersededOutputs();
 
     return;
   }
 
 #ifdef _MPI_
-  auto found = scenarioStatus_.find(newVariation);
-  if (found != scenarioStatus_.end()) {
-    TraceInfo(logTag_) << DYNAlgorithmsLog(ScenarioResultsFound, newVariation) << Trace::endline;
-    for (const auto& eventId : eventsId) {
-      auto resultId = SimulationResult::getUniqueScenarioId(events.at(eventId)->getId(), newVariation);
-      result.getScenarioResult(eventId) = importResult(resultId);
-    }
-    return;
+  // only launch the scenarios that were neither launched for this variation nor already decided by their bounds
+  task_t requestedTask(task.minVariation_, task.maxVariation_);
+  requestedTask.variation_ = task.variation_;
+  for (const auto eventId : eventsId) {
+    if (!isScenarioLaunched(eventId, newVariation) && !isScenarioDecided(eventId, newVariation))
+      requestedTask.ids_.push_back(eventId);
   }
 
-  std::vector<std::pair<size_t, double> > events2Run;
-  prepareEvents2Run(task, toRun, events2Run);
+  if (requestedTask.ids_.empty()) {
+    TraceInfo(logTag_) << DYNAlgorithmsLog(ScenarioResultsFound, newVariation) << Trace::endline;
+  } else {
+    std::vector<std::pair<size_t, double> > events2Run;
+    prepareEvents2Run(requestedTask, toRun, events2Run);
+
+    for (const auto& event2Run : events2Run) {
+      double variation = event2Run.second;
+      std::string iidmFile = generateIDMFileNameForVariation(variation);
+      if (inputsByIIDM_.count(iidmFile) == 0) {
+        inputsByIIDM_[iidmFile].readInputs(workingDirectory_, baseJobsFile, iidmFile);
+      }
+    }
 
-  for (const auto& event2Run : events2Run) {
-    double variation = event2Run.second;
-    std::string iidmFile = generateIDMFileNameForVariation(variation);
-    if (inputsByIIDM_.count(iidmFile) == 0) {
-      inputsByIIDM_[iidmFile].readInputs(workingDirectory_, baseJobsFile, iidmFile);
+    std::vector<unsigned int> statuses;
+    std::vector<double> failureRatios;
+    multiprocessing::forEach(0, events2Run.size(), [this, &events2Run, &events, &statuses, &failureRatios](unsigned int i){
+      double variation = events2Run[i].second;
+      std::string iidmFile = generateIDMFileNameForVariation(variation);
+      size_t eventIdx = events2Run[i].first;
+      SimulationResult resultScenario;
+      createScenarioWorkingDir(computeScenarioId(events.at(eventIdx)->getId()), variation);
+      launchScenario(inputsByIIDM_.at(iidmFile), events.at(eventIdx), variation, resultScenario);
+      statuses.push_back(static_cast<unsigned int>(resultScenario.getStatus()));
+      failureRatios.push_back(computeFailureRatio(resultScenario));
+      exportResult(resultScenario);
+    });
+    // Sync status
+    std::vector<unsigned int> allStatuses = synchronizeStatuses(statuses);
+    std::vector<double> allFailureRatios = synchronizeFailureRatios(failureRatios);
+    for (unsigned int i = 0; i < events2Run.size(); i++) {
+      auto& event = events2Run.at(i);
+      const status_t status = static_cast<status_t>(allStatuses.at(i));
+      scenarioStatus_[event.second][event.first].success = (status == CONVERGENCE_STATUS);
+      updateScenarioBounds(event.first, event.second, status, allFailureRatios.at(i));
     }
-  }
 
-  std::vector<bool> successes;
-  multiprocessing::forEach(0, events2Run.size(), [this, &events2Run, &events, &successes](unsigned int i){
-    double variation = events2Run[i].second;
-    std::string iidmFile = generateIDMFileNameForVariation(variation);
-    size_t eventIdx = events2Run[i].first;
-    SimulationResult resultScenario;
-    createScenarioWorkingDir(events.at(eventIdx)->getId(), variation);
-    launchScenario(inputsByIIDM_.at(iidmFile), events.at(eventIdx), variation, resultScenario);
-    successes.push_back(resultScenario.getSuccess());
-    exportResult(resultScenario);
-  });
-  // Sync successes
-  std::vector<bool> allSuccesses = synchronizeSuccesses(successes);
-  for (unsigned int i = 0; i < events2Run.size(); i++) {
-    auto& event = events2Run.at(i);
-    scenarioStatus_[event.second].resize(events.size());
-    scenarioStatus_.at(event.second).at(event.first).success = allSuccesses.at(i);
+    for (const auto& event2Run : events2Run) {
+      double variation = event2Run.second;
+      std::string iidmFile = generateIDMFileNameForVariation(variation);
+      inputsByIIDM_.erase(iidmFile);  // remove iidm file used for scenario to save RAM
+    }
   }
-  assert(scenarioStatus_.count(newVariation) > 0);
 
   for (const auto& eventId : eventsId) {
-    auto resultId = SimulationResult::getUniqueScenarioId(events.at(eventId)->getId(), newVariation);
-    result.getScenarioResult(eventId) = importResult(resultId);
-  }
-
-  for (const auto& event2Run : events2Run) {
-    double variation = event2Run.second;
-    std::string iidmFile = generateIDMFileNameForVariation(variation);
-    inputsByIIDM_.erase(iidmFile);  // remove iidm file used for scenario to save RAM
+    if (isScenarioLaunched(eventId, newVariation)) {
+      auto resultId = SimulationResult::getUniqueScenarioId(computeScenarioId(events.at(eventId)->getId()), newVariation);
+      result.getScenarioResult(eventId) = importResult(resultId, false);
+    } else {
+      assert(isScenarioDecided(eventId, newVariation));
+      fillDecidedScenarioResult(eventId, events.at(eventId)->getId(), newVariation, result.getScenarioResult(eventId));
+    }
   }
 #endif
 }
@@ -567,7 +879,7 @@ MarginCalculationLauncher::prepareEvents2Run(const task_t& requestedTask,
     std::queue< task_t >& toRun,
     std::vector<std::pair<size_t, double> >& events2Run) {
   const std::vector<size_t>& eventsId = requestedTask.ids_;
-  double newVariation = round((requestedTask.minVariation_ + requestedTask.maxVariation_)/2.);
+  double newVariation = requestedTask.variation_;
   auto it = loadIncreaseStatus_.find(newVariation);
   if (it != loadIncreaseStatus_.end() && it->second.success) {
     for (const auto eventId : eventsId) {
@@ -578,16 +890,119 @@ MarginCalculationLauncher::prepareEvents2Run(const task_t& requestedTask,
     task_t newTask = toRun.front();
     toRun.pop();
     const std::vector<size_t>& newEventsId = newTask.ids_;
-    double variation = round((newTask.minVariation_ + newTask.maxVariation_)/2.);
+    double variation = newTask.variation_;
     it = loadIncreaseStatus_.find(variation);
     if (it == loadIncreaseStatus_.end() || !it->second.success) continue;
-    if (scenarioStatus_.find(variation) != scenarioStatus_.end()) continue;
     for (const auto newEventId : newEventsId) {
+      if (isScenarioLaunched(newEventId, variation) || isScenarioDecided(newEventId, variation))
+        continue;
+      if (std::find(events2Run.begin(), events2Run.end(), std::make_pair(newEventId, variation)) != events2Run.end())
+        continue;
       events2Run.emplace_back(std::make_pair(newEventId, variation));
     }
   }
 }
 
+void
+MarginCalculationLauncher::updateScenarioBounds(size_t eventIdx, double variation, status_t status, double failureRatio) {
+  ScenarioBounds& bounds = scenarioBounds_.at(eventIdx);
+  if (variation < bounds.knownPass_ || DYN::doubleEquals(variation, bounds.knownPass_) ||
+      variation > bounds.knownFail_ || DYN::doubleEquals(variation, bounds.knownFail_))
+    return;  // already decided
+  if (status == CONVERGENCE_STATUS) {
+    bounds.knownPass_ = variation;
+  } else {
+    bounds.knownFail_ = variation;
+    bounds.knownFailStatus_ = status;
+    bounds.knownFailRatio_ = failureRatio;
+  }
+}
+
+double
+MarginCalculationLauncher::computeFailureRatio(const SimulationResult& result) const {
+  if (result.getStatus() != CRITERIA_NON_RESPECTED_STATUS || result.getFailingCriteria().empty() || tScenario_ <= 0.)
+    return -1.;
+  double failureTime = std::numeric_limits<double>::max();
+  for (const auto& criteria : result.getFailingCriteria())
+    failureTime = std::min(failureTime, criteria.first);
+  const double startTime = tLoadIncrease_ - (100. - result.getVariation())/100. * inputs_.getTLoadIncreaseVariationMax();
+  return std::max(0., std::min(1., (failureTime - startTime) / tScenario_));
+}
+
+double
+MarginCalculationLauncher::selectTaskVariation(const task_t& task) const {
+  const double middle = round((task.minVariation_ + task.maxVariation_)/2.);
+  if (task.ids_.empty())
+    return middle;
+  // on the bracket, mapped to [0,1], the margin of each scenario is given the density 1 + k(2u - 1) with k in [-1,1]:
+  // k = 2r - 1 where r is the failure ratio of the scenario at the upper bound, k = 0 (uniform) if unknown
+  double meanSlope = 0.;
+  for (const auto eventId : task.ids_) {
+    const ScenarioBounds& bounds = scenarioBounds_.at(eventId);
+    if (DYN::doubleEquals(bounds.knownFail_, task.maxVariation_) && bounds.knownFailRatio_ >= 0.)
+      meanSlope += 2. * bounds.knownFailRatio_ - 1.;
+  }
+  meanSlope /= task.ids_.size();
+  // the cumulative distribution of the mixture is k u^2 + (1 - k) u with k the mean slope, its median solves k u^2 + (1 - k) u = 1/2
+  double median = 0.5;
+  if (std::abs(meanSlope) > 1e-6)
+    median = (meanSlope - 1. + std::sqrt(1. + meanSlope * meanSlope)) / (2. * meanSlope);
+  const double variation = std::round(task.minVariation_ + median * (task.maxVariation_ - task.minVariation_));
+  if (variation < task.minVariation_ || DYN::doubleEquals(variation, task.minVariation_) ||
+      variation > task.maxVariation_ || DYN::doubleEquals(variation, task.maxVariation_))
+    return middle;
+  return variation;
+}
+
+bool
+MarginCalculationLauncher::isScenarioDecided(size_t eventIdx, double variation) const {
+  const ScenarioBounds& bounds = scenarioBounds_.at(eventIdx);
+  return variation < bounds.knownPass_ || DYN::doubleEquals(variation, bounds.knownPass_) || isScenarioKnownToFail(eventIdx, variation);
+}
+
+bool
+MarginCalculationLauncher::isScenarioKnownToFail(size_t eventIdx, double variation) const {
+  const ScenarioBounds& bounds = scenarioBounds_.at(eventIdx);
+  return variation > bounds.knownFail_ || DYN::doubleEquals(variation, bounds.knownFail_);
+}
+
+void
+MarginCalculationLauncher::fillDecidedScenarioResult(size_t eventIdx, const std::string& scenarioId, double variation, SimulationResult& result) const {
+  assert(isScenarioDecided(eventIdx, variation));
+  const bool success = !isScenarioKnownToFail(eventIdx, variation);
+  result.setScenarioId(computeScenarioId(scenarioId));
+  result.setVariation(variation);
+  result.setSuccess(success);
+  result.setStatus(success ? CONVERGENCE_STATUS : scenarioBounds_.at(eventIdx).knownFailStatus_);
+}
+
+void
+MarginCalculationLauncher::recordDecidedLoadLevel(const std::vector<boost::shared_ptr<Scenario> >& events, double variation) {
+  std::vector<size_t> decidedEventsIds;
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (isScenarioDecided(i, variation))
+      decidedEventsIds.push_back(i);
+  }
+  results_.emplace_back(decidedEventsIds.size());
+  LoadIncreaseResult& loadIncreaseResult = results_.back();
+  // the load increase is not simulated for this level: it has no status of its own
+  loadIncreaseResult.setDecided(true);
+  loadIncreaseResult.getResult().setVariation(variation);
+  for (size_t i = 0; i < decidedEventsIds.size(); ++i) {
+    const size_t eventId = decidedEventsIds[i];
+    SimulationResult& result = loadIncreaseResult.getScenarioResult(i);
+    fillDecidedScenarioResult(eventId, events[eventId]->getId(), variation, result);
+    TraceInfo(logTag_) << DYNAlgorithmsLog(ScenarioNotSimulated, result.getUniqueScenarioId()) << Trace::endline;
+  }
+  TraceInfo(logTag_) << Trace::endline;
+}
+
+bool
+MarginCalculationLauncher::isScenarioLaunched(size_t eventIdx, double variation) const {
+  auto found = scenarioStatus_.find(variation);
+  return found != scenarioStatus_.end() && found->second.count(eventIdx) > 0;
+}
+
 void
 MarginCalculationLauncher::launchScenario(const MultiVariantInputs& inputs, const boost::shared_ptr<Scenario>& scenario,
     const double variation, SimulationResult& result) {
@@ -597,16 +1012,18 @@ MarginCalculationLauncher::launchScenario(const MultiVariantInputs& inputs, cons
 
   std::stringstream subDir;
   subDir << "step-" << variation;
-  std::string workingDir = createAbsolutePath(scenario->getId(), createAbsolutePath(subDir.str(), workingDirectory_));
+  std::string workingDir = createAbsolutePath(computeScenarioId(scenario->getId()), createAbsolutePath(subDir.str(), workingDirectory_));
   std::shared_ptr<job::JobEntry> job = inputs.cloneJobEntry();
 
   addDydFileToJob(job, scenario->getDydFile());
+  if (!scenario->getEvents().empty())
+    addDydFileToJob(job, computeEventsDydFile(computeEventsDirectory(scenario->getId())));
   setCriteriaFileForJob(job, scenario->getCriteriaFile());
 
   SimulationParameters params;
   initParametersWithJob(job, params);
   std::stringstream dumpFile;
-  dumpFile << "loadIncreaseFinalState-" << variation << ".dmp";
+  dumpFile << computeDirectionId("loadIncreaseFinalState") << "-" << variation << ".dmp";
   //  force simulation to load previous dump and to use final values
   params.InitialStateFile_ = createAbsolutePath(dumpFile.str(), workingDirectory_);
   params.iidmFile_ = generateIDMFileNameForVariation(variation);
@@ -616,38 +1033,26 @@ MarginCalculationLauncher::launchScenario(const MultiVariantInputs& inputs, cons
   params.startTime_ = startTime;
   params.stopTime_ = startTime + tScenario_;
 
-  result.setScenarioId(scenario->getId());
+  result.setScenarioId(computeScenarioId(scenario->getId()));
   result.setVariation(variation);
   boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, inputs);
 
   if (simulation) {
     simulation->setTimelineOutputFile("");
     simulation->setConstraintsOutputFile("");
-    // The event time should be adapted (the list of events models supported currently corresponds to events really used)
+    // The event time should be adapted
     std::shared_ptr<DYN::ModelMulti> modelMulti = std::dynamic_pointer_cast<DYN::ModelMulti>(simulation->getModel());
-    std::string DDBDir = getEnvVar("DYNAWO_DDB_DIR");
-    decltype(modelMulti->findSubModelByLib("")) subModels;
-    auto addSubModelsByLib = [&](const std::string& libName) {
-      auto subModelsToAdd = modelMulti->findSubModelByLib(createAbsolutePath(libName + DYN::sharedLibraryExtension(), DDBDir));
-      subModels.insert(subModels.end(), subModelsToAdd.begin(), subModelsToAdd.end());
-    };
-    addSubModelsByLib("EventQuadripoleDisconnection");
-    addSubModelsByLib("EventConnectedStatus");
-    addSubModelsByLib("EventSetPointBoolean");
-    addSubModelsByLib("SetPoint");
-    addSubModelsByLib("EventSetPointReal");
-    addSubModelsByLib("EventSetPointDoubleReal");
-    addSubModelsByLib("EventSetPointGenerator");
-    addSubModelsByLib("EventSetPointLoad");
-    addSubModelsByLib("LineTrippingEvent");
-    addSubModelsByLib("TfoTrippingEvent");
-    addSubModelsByLib("EventQuadripoleConnection");
-    for (const auto& subModel : subModels) {
+    double lastEventTime = startTime;
+    for (const auto& subModelName : findEventSubModels(simulation, scenario->getId())) {
+      auto subModel = modelMulti->findSubModelByName(subModelName);
       double tEvent = subModel->findParameterDynamic("event_tEvent").getValue<double>();
-      subModel->setParameterValue("event_tEvent", DYN::PAR, tEvent - (100. - variation) * inputs_.getTLoadIncreaseVariationMax() / 100., false);
+      tEvent -= (100. - variation) * inputs_.getTLoadIncreaseVariationMax() / 100.;
+      subModel->setParameterValue("event_tEvent", DYN::PAR, tEvent, false);
       subModel->setSubModelParameters();
+      lastEventTime = std::max(lastEventTime, tEvent);
     }
-    simulate(simulation, result);
+    // the outputs of the screening are never exported
+    simulate(simulation, result, lastEventTime, !screening_);
   }
 
   if (multiprocessing::context().nbProcs() == 1)
@@ -690,33 +1095,55 @@ MarginCalculationLauncher::generateVariationsToLaunch(unsigned int maxNumber, do
 }
 
 #ifdef _MPI_
-std::vector<bool>
-MarginCalculationLauncher::synchronizeSuccesses(const std::vector<bool>& successes) {
+/**
+ * @brief Gather the data of all process into the root process and broadcast it to all process after
+ *
+ * @param data the data of current process
+ * @return The data of all procs, ordered by index of attribution
+ */
+template<class T>
+static std::vector<T>
+synchronizeData(const std::vector<T>& data) {
   auto& context = multiprocessing::context();
-  std::vector<std::vector<bool>> gatheredSuccesses;
-  context.gather(successes, gatheredSuccesses);
-  std::vector<bool> allSuccesses;
+  std::vector<std::vector<T>> gatheredData;
+  context.gather(data, gatheredData);
+  std::vector<T> allData;
   if (context.isRootProc()) {
     auto size =
-      std::accumulate(gatheredSuccesses.begin(), gatheredSuccesses.end(), 0, [](size_t sum, const std::vector<bool>& data) { return sum + data.size(); });
-    allSuccesses.resize(size);
+      std::accumulate(gatheredData.begin(), gatheredData.end(), 0, [](size_t sum, const std::vector<T>& procData) { return sum + procData.size(); });
+    allData.resize(size);
     for (unsigned int i = 0; i < context.nbProcs(); i++) {
-      const auto& vect = gatheredSuccesses.at(i);
+      const auto& vect = gatheredData.at(i);
       for (unsigned int j = 0; j < vect.size(); j++) {
         // variations were attributed to procs following the formula: "index % nbprocs == rank" throught forEach function
-        allSuccesses.at(j * context.nbProcs() + i) = vect.at(j);
+        allData.at(j * context.nbProcs() + i) = vect.at(j);
       }
     }
   }
-  context.broadcast(allSuccesses);
-  return allSuccesses;
+  context.broadcast(allData);
+  return allData;
+}
+
+std::vector<bool>
+MarginCalculationLauncher::synchronizeSuccesses(const std::vector<bool>& successes) {
+  return synchronizeData(successes);
+}
+
+std::vector<unsigned int>
+MarginCalculationLauncher::synchronizeStatuses(const std::vector<unsigned int>& statuses) {
+  return synchronizeData(statuses);
+}
+
+std::vector<double>
+MarginCalculationLauncher::synchronizeFailureRatios(const std::vector<double>& failureRatios) {
+  return synchronizeData(failureRatios);
 }
 #endif
 
 std::string
-MarginCalculationLauncher::computeLoadIncreaseScenarioId(double variation) {
+MarginCalculationLauncher::computeLoadIncreaseScenarioId(double variation) const {
   std::stringstream ss;
-  ss << LOAD_INCREASE << "-" << variation;
+  ss << computeDirectionId(LOAD_INCREASE) << "-" << variation;
   return ss.str();
 }
 
@@ -736,9 +1163,22 @@ MarginCalculationLauncher::findOrLaunchLoadIncrease(const boost::shared_ptr<Load
   TraceInfo(logTag_) << DYNAlgorithmsLog(VariationValue, variation) << Trace::endline;
 
   auto found = loadIncreaseStatus_.find(variation);
+  if (found != loadIncreaseStatus_.end() && found->second.success && collectedLoadIncreaseLevels_.count(variation) > 0) {
+    // the final state of this level was removed: the load increase is launched again to rebuild it
+    collectedLoadIncreaseLevels_.erase(variation);
+    loadIncreaseStatus_.erase(found);
+    found = loadIncreaseStatus_.end();
+  }
   if (found != loadIncreaseStatus_.end()) {
-    const SimulationResult importedLoadIncreaseResult1 = importResult(computeLoadIncreaseScenarioId(variation));
-    loadIncreaseResult.setResult(importedLoadIncreaseResult1);
+    if (multiprocessing::context().nbProcs() == 1) {
+      // the outputs are only kept for a level which is not already stored in the results
+      SimulationResult& sequentialLoadIncreaseResult = sequentialLoadIncreaseResults_.at(variation);
+      loadIncreaseResult.setResult(sequentialLoadIncreaseResult);
+      sequentialLoadIncreaseResult.clearOutputs();
+    } else {
+      const SimulationResult importedLoadIncreaseResult1 = importResult(computeLoadIncreaseScenarioId(variation), false);
+      loadIncreaseResult.setResult(importedLoadIncreaseResult1);
+    }
     TraceInfo(logTag_) << DYNAlgorithmsLog(LoadIncreaseResultsFound, variation) << Trace::endline;
     return;
   }
@@ -747,6 +1187,9 @@ MarginCalculationLauncher::findOrLaunchLoadIncrease(const boost::shared_ptr<Load
     inputs_.readInputs(workingDirectory_, loadIncrease->getJobsFile());
     SimulationResult& loadIncreaseSimulationResult = loadIncreaseResult.getResult();
     launchLoadIncrease(loadIncrease, variation, loadIncreaseSimulationResult);
+    SimulationResult& sequentialLoadIncreaseResult = sequentialLoadIncreaseResults_[variation];
+    sequentialLoadIncreaseResult = loadIncreaseSimulationResult;
+    sequentialLoadIncreaseResult.clearOutputs();
     loadIncreaseStatus_.insert(std::make_pair(variation, LoadIncreaseStatus(loadIncreaseSimulationResult.getSuccess())));
 
     // Hack to add 0. if the load increase is below 50. as we know we never did 0. in the first place
@@ -755,8 +1198,10 @@ MarginCalculationLauncher::findOrLaunchLoadIncrease(const boost::shared_ptr<Load
       SimulationResult result0;
       inputs_.readInputs(workingDirectory_, loadIncrease->getJobsFile());
       launchLoadIncrease(loadIncrease, 0., result0);
+      sequentialLoadIncreaseResults_[0.] = result0;
       loadIncreaseStatus_.insert(std::make_pair(0., LoadIncreaseStatus(result0.getSuccess())));
     }
+    dropSupersededOutputs();
     return;
   }
 
@@ -781,11 +1226,11 @@ MarginCalculationLauncher::findOrLaunchLoadIncrease(const boost::shared_ptr<Load
   for (unsigned int i = 0; i < variationsToLaunch.size(); i++) {
     auto currVariation = variationsToLaunch.at(i);
     loadIncreaseStatus_.insert(std::make_pair(currVariation, LoadIncreaseStatus(allSuccesses.at(i))));
-    const SimulationResult importedLoadIncreaseResult2 = importResult(computeLoadIncreaseScenarioId(currVariation));
+    const SimulationResult importedLoadIncreaseResult2 = importResult(computeLoadIncreaseScenarioId(currVariation), false);
     TraceInfo(logTag_) << DYNAlgorithmsLog(LoadIncreaseEnd, currVariation, getStatusAsString(importedLoadIncreaseResult2.getStatus())) << Trace::endline;
   }
   assert(loadIncreaseStatus_.count(variation) > 0);
-  const SimulationResult importedLoadIncreaseResult3 = importResult(computeLoadIncreaseScenarioId(variation));
+  const SimulationResult importedLoadIncreaseResult3 = importResult(computeLoadIncreaseScenarioId(variation), false);
   loadIncreaseResult.setResult(importedLoadIncreaseResult3);
 #endif
 }
@@ -806,13 +1251,13 @@ MarginCalculationLauncher::launchLoadIncrease(const boost::shared_ptr<LoadIncrea
   params.activateDumpFinalState_ = true;
   params.activateExportIIDM_ = true;
   std::stringstream iidmFile;
-  iidmFile << "loadIncreaseFinalState-" << variation << ".iidm";
+  iidmFile << computeDirectionId("loadIncreaseFinalState") << "-" << variation << ".iidm";
   params.exportIIDMFile_ = createAbsolutePath(iidmFile.str(), workingDirectory_);
   std::stringstream dumpFile;
-  dumpFile << "loadIncreaseFinalState-" << variation << ".dmp";
+  dumpFile << computeDirectionId("loadIncreaseFinalState") << "-" << variation << ".dmp";
   params.dumpFinalStateFile_ = createAbsolutePath(dumpFile.str(), workingDirectory_);
 
-  result.setScenarioId(LOAD_INCREASE);
+  result.setScenarioId(computeDirectionId(LOAD_INCREASE));
   result.setVariation(variation);
   boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, inputs_);
 
@@ -877,59 +1322,221 @@ MarginCalculationLauncher::createOutputs(std::map<std::string, std::string>& map
     exporter.exportLoadIncreaseResultsToFile(results_, outputFileFullPath_);
   }
 
-  std::map<std::string, SimulationResult> bestResults;
-  std::map<std::string, SimulationResult> worstResults;
+  std::map<std::string, double> bestLoadLevels;
+  std::map<std::string, double> worstLoadLevels;
+  findExportedLoadLevels(bestLoadLevels, worstLoadLevels);
+
+  // a result may be stored several times: its outputs are written only once
+  std::set<std::string> exportedResults;
+  auto createResultOutputs = [&](const SimulationResult& result) {
+    const std::string scenarioId = result.getScenarioId();
+    auto best = bestLoadLevels.find(scenarioId);
+    auto worst = worstLoadLevels.find(scenarioId);
+    const bool exported = (best != bestLoadLevels.end() && DYN::doubleEquals(best->second, result.getVariation()))
+        || (worst != worstLoadLevels.end() && DYN::doubleEquals(worst->second, result.getVariation()));
+    if (!exported || !exportedResults.insert(result.getUniqueScenarioId()).second)
+      return;
+    if (zipIt) {
+      storeOutputs(result, mapData);
+    } else {
+      writeOutputs(result);
+    }
+  };
+  for (const auto& loadIncreaseResult : results_) {
+    createResultOutputs(loadIncreaseResult.getResult());
+    for (const SimulationResult& scenarioResult : loadIncreaseResult.getScenariosResults())
+      createResultOutputs(scenarioResult);
+  }
+}
 
+void
+MarginCalculationLauncher::findExportedLoadLevels(std::map<std::string, double>& bestLoadLevels,
+    std::map<std::string, double>& worstLoadLevels) const {
   for (const auto& loadIncreaseResult : results_) {
+    // the verdicts of the screening research are only used to bracket the margins
+    if (loadIncreaseResult.isScreening())
+      continue;
     const double loadLevel = loadIncreaseResult.getResult().getVariation();
     const std::vector<SimulationResult>& allScenariosResults = loadIncreaseResult.getScenariosResults();
     size_t numberOfSuccessfulScenarios = 0;
+    const bool launched = areScenariosLaunched(loadIncreaseResult);
     for (const SimulationResult& scenarioResult : allScenariosResults) {
-      const std::string& scenarioId = scenarioResult.getScenarioId();
+      const std::string scenarioId = scenarioResult.getScenarioId();
+      if (scenarioId.empty() && !launched)
+        continue;
       if (scenarioResult.getSuccess()) {
         ++numberOfSuccessfulScenarios;
-        const std::map<std::string, SimulationResult>::const_iterator itBest = bestResults.find(scenarioId);
-        if (itBest == bestResults.end() || (loadLevel > itBest->second.getVariation()))
-          bestResults[scenarioId] = scenarioResult;
+        auto itBest = bestLoadLevels.find(scenarioId);
+        if (itBest == bestLoadLevels.end() || loadLevel > itBest->second)
+          bestLoadLevels[scenarioId] = loadLevel;
       } else {
-        const std::map<std::string, SimulationResult>::const_iterator itWorst = worstResults.find(scenarioId);
-        if (itWorst == worstResults.end() || loadLevel < itWorst->second.getVariation())
-          worstResults[scenarioId] = scenarioResult;
+        auto itWorst = worstLoadLevels.find(scenarioId);
+        if (itWorst == worstLoadLevels.end() || loadLevel < itWorst->second)
+          worstLoadLevels[scenarioId] = loadLevel;
       }
     }
+    const std::string& loadIncreaseId = loadIncreaseResult.getResult().getScenarioId();
+    if (loadIncreaseId.empty() || !launched)
+      continue;
     if (loadIncreaseResult.getResult().getSuccess() && numberOfSuccessfulScenarios == allScenariosResults.size()) {
-      const std::map<std::string, SimulationResult>::const_iterator loadIncreaseBestIt = bestResults.find(LOAD_INCREASE);
-      if (loadIncreaseBestIt == bestResults.end() || loadLevel > loadIncreaseBestIt->second.getVariation()) {
-        bestResults[LOAD_INCREASE] = loadIncreaseResult.getResult();
-      }
+      auto loadIncreaseBestIt = bestLoadLevels.find(loadIncreaseId);
+      if (loadIncreaseBestIt == bestLoadLevels.end() || loadLevel > loadIncreaseBestIt->second)
+        bestLoadLevels[loadIncreaseId] = loadLevel;
     } else {
-      const std::map<std::string, SimulationResult>::const_iterator loadIncreaseWorstIt = worstResults.find(LOAD_INCREASE);
-      if (loadIncreaseWorstIt == worstResults.end() || loadLevel < loadIncreaseWorstIt->second.getVariation()) {
-        worstResults[LOAD_INCREASE] = loadIncreaseResult.getResult();
-      }
+      auto loadIncreaseWorstIt = worstLoadLevels.find(loadIncreaseId);
+      if (loadIncreaseWorstIt == worstLoadLevels.end() || loadLevel < loadIncreaseWorstIt->second)
+        worstLoadLevels[loadIncreaseId] = loadLevel;
     }
   }
+}
 
-  for (const auto& bestResult : bestResults) {
-    if (zipIt) {
-      storeOutputs(bestResult.second, mapData);
-    } else {
-      writeOutputs(bestResult.second);
+void
+MarginCalculationLauncher::retainExportedOutputs() {
+  std::map<std::string, double> bestLoadLevels;
+  std::map<std::string, double> worstLoadLevels;
+  findExportedLoadLevels(bestLoadLevels, worstLoadLevels);
+
+  auto isExported = [&bestLoadLevels, &worstLoadLevels](const SimulationResult& result) {
+    auto best = bestLoadLevels.find(result.getScenarioId());
+    auto worst = worstLoadLevels.find(result.getScenarioId());
+    return (best != bestLoadLevels.end() && DYN::doubleEquals(best->second, result.getVariation()))
+        || (worst != worstLoadLevels.end() && DYN::doubleEquals(worst->second, result.getVariation()));
+  };
+  auto readOutputs = [this](SimulationResult& result) {
+    // results deduced from the bounds of a scenario were never simulated and have no save file
+    if (boost::filesystem::exists(computeResultFile(result.getUniqueScenarioId())))
+      result = importResult(result.getUniqueScenarioId());
+  };
+  for (auto& loadIncreaseResult : results_) {
+    if (isExported(loadIncreaseResult.getResult()))
+      readOutputs(loadIncreaseResult.getResult());
+    for (size_t i = 0; i < loadIncreaseResult.getScenariosResults().size(); ++i) {
+      if (isExported(loadIncreaseResult.getScenarioResult(i)))
+        readOutputs(loadIncreaseResult.getScenarioResult(i));
     }
   }
-  for (const auto& worstResult : worstResults) {
-    if (zipIt) {
-      storeOutputs(worstResult.second, mapData);
-    } else {
-      writeOutputs(worstResult.second);
+}
+
+void
+MarginCalculationLauncher::dropSupersededOutputs() {
+  // the screening results are not flagged yet and would supersede the full duration ones; they have no outputs anyway
+  if (screening_)
+    return;
+  std::map<std::string, double> bestLoadLevels;
+  std::map<std::string, double> worstLoadLevels;
+  findExportedLoadLevels(bestLoadLevels, worstLoadLevels);
+
+  auto isExported = [&bestLoadLevels, &worstLoadLevels](const SimulationResult& result) {
+    auto best = bestLoadLevels.find(result.getScenarioId());
+    auto worst = worstLoadLevels.find(result.getScenarioId());
+    return (best != bestLoadLevels.end() && DYN::doubleEquals(best->second, result.getVariation()))
+        || (worst != worstLoadLevels.end() && DYN::doubleEquals(worst->second, result.getVariation()));
+  };
+  for (auto& loadIncreaseResult : results_) {
+    // a level whose scenarios are still to be launched may become an exported one: its outputs are kept until they are known
+    if (loadIncreaseResult.isScreening() || !areScenariosLaunched(loadIncreaseResult))
+      continue;
+    if (!loadIncreaseResult.getResult().getScenarioId().empty() && !isExported(loadIncreaseResult.getResult()))
+      loadIncreaseResult.getResult().clearOutputs();
+    for (size_t i = 0; i < loadIncreaseResult.getScenariosResults().size(); ++i) {
+      SimulationResult& scenarioResult = loadIncreaseResult.getScenarioResult(i);
+      if (!scenarioResult.getScenarioId().empty() && !isExported(scenarioResult))
+        scenarioResult.clearOutputs();
+    }
+  }
+}
+
+void
+MarginCalculationLauncher::collectLoadIncreaseStates(const std::vector<std::pair<double, double> >& activeBrackets) {
+  std::vector<double> levelsToCollect;
+  for (const auto& status : loadIncreaseStatus_) {
+    if (collectedLoadIncreaseLevels_.count(status.first) > 0)
+      continue;
+    bool active = false;
+    for (const auto& bracket : activeBrackets) {
+      if (!dynawoDoubleLess()(status.first, bracket.first) && !dynawoDoubleLess()(bracket.second, status.first)) {
+        active = true;
+        break;
+      }
     }
+    if (!active)
+      levelsToCollect.push_back(status.first);
   }
+  if (levelsToCollect.empty())
+    return;
+
+  // every process takes the same decision, the files are only removed once all of them stopped using them
+  multiprocessing::Context::sync();
+  const bool archiveStates = multipleJobs_->getMarginCalculation()->getArchiveLoadIncreaseStates();
+  for (const auto variation : levelsToCollect) {
+    const std::string iidmFile = generateIDMFileNameForVariation(variation);
+    std::stringstream dumpFile;
+    dumpFile << computeDirectionId("loadIncreaseFinalState") << "-" << variation << ".dmp";
+    std::vector<std::string> stateFiles;
+    stateFiles.push_back(createAbsolutePath(dumpFile.str(), workingDirectory_));
+    stateFiles.push_back(iidmFile);
+
+    if (multiprocessing::context().isRootProc()) {
+      if (archiveStates) {
+        boost::shared_ptr<zip::ZipFile> archive = zip::ZipFileFactory::newInstance();
+        for (const auto& stateFile : stateFiles) {
+          if (!exists(stateFile))
+            continue;
+          std::ifstream inFile(stateFile.c_str(), std::ios::binary);
+          std::stringstream data;
+          data << inFile.rdbuf();
+          archive->addEntry(boost::filesystem::path(stateFile).filename().string(), data.str());
+        }
+        if (!archive->getEntries().empty()) {
+          std::stringstream zipFile;
+          zipFile << computeDirectionId("loadIncreaseFinalState") << "-" << variation << ".zip";
+          zip::ZipOutputStream::write(createAbsolutePath(zipFile.str(), workingDirectory_), archive);
+          TraceInfo(logTag_) << DYNAlgorithmsLog(LoadIncreaseStateArchived, variation, zipFile.str()) << Trace::endline;
+        }
+      }
+      for (const auto& stateFile : stateFiles) {
+        if (exists(stateFile))
+          remove(stateFile);
+      }
+      TraceInfo(logTag_) << DYNAlgorithmsLog(LoadIncreaseStateCollected, variation) << Trace::endline;
+    }
+    inputsByIIDM_.erase(iidmFile);
+    collectedLoadIncreaseLevels_.insert(variation);
+  }
+}
+
+std::string
+MarginCalculationLauncher::computeDirectionId(const std::string& id) const {
+  if (loadIncreaseDirection_.empty())
+    return id;
+  return loadIncreaseDirection_ + "_" + id;
+}
+
+std::string
+MarginCalculationLauncher::computeScenarioId(const std::string& scenarioId) const {
+  if (screening_)
+    return computeDirectionId(scenarioId) + "_screening";
+  return computeDirectionId(scenarioId);
+}
+
+std::string
+MarginCalculationLauncher::computeEventsDirectory(const std::string& scenarioId) const {
+  return createAbsolutePath(computeDirectionId(scenarioId), createAbsolutePath("events", workingDirectory_));
+}
+
+void
+MarginCalculationLauncher::writeScenariosEventsFiles(const std::vector<boost::shared_ptr<Scenario> >& events) const {
+  if (multiprocessing::context().isRootProc()) {
+    for (const auto& scenario : events)
+      writeEventsFiles(scenario, computeEventsDirectory(scenario->getId()));
+  }
+  multiprocessing::Context::sync();
 }
 
 std::string
 MarginCalculationLauncher::generateIDMFileNameForVariation(double variation) const {
   std::stringstream iidmFile;
-  iidmFile << "loadIncreaseFinalState-" << variation << ".iidm";
+  iidmFile << computeDirectionId("loadIncreaseFinalState") << "-" << variation << ".iidm";
   return createAbsolutePath(iidmFile.str(), workingDirectory_);
 }
 
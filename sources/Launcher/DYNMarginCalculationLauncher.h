@@ -23,14 +23,18 @@
 #include <string>
 #include <vector>
 #include <queue>
+#include <limits>
+#include <cmath>
 #include <boost/shared_ptr.hpp>
 #include <DYNCommon.h>
 #include "DYNRobustnessAnalysisLauncher.h"
 #include "DYNLoadIncreaseResult.h"
 #include <map>
+#include <set>
 
 namespace DYNAlgorithms {
 class LoadIncrease;
+class MarginCalculation;
 class Scenario;
 class LoadIncreaseResult;
 /**
@@ -40,12 +44,17 @@ class LoadIncreaseResult;
  */
 class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
  public:
+  /**
+   * @brief default constructor
+   */
+  MarginCalculationLauncher();
+
   /**
    * @copydoc RobustnessAnalysisLauncher::launch()
    */
   void launch();
 
- private:
+ protected:
   /**
    * @brief create outputs file for each job
    * @param mapData map associating a fileName and the data contained in the file
@@ -53,12 +62,28 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
    */
   void createOutputs(std::map<std::string, std::string>& mapData, bool zipIt) const;
 
+  /**
+   * @brief Compute the margin of the scenarios for one load increase
+   *
+   * @param marginCalculation margin calculation to launch
+   * @param loadIncrease load increase giving the direction of the variation
+   */
+  void computeMargin(const boost::shared_ptr<MarginCalculation>& marginCalculation, const boost::shared_ptr<LoadIncrease>& loadIncrease);
+
+  /**
+   * @brief Forget the state of the research of the previous load increase
+   *
+   * @param nbScenarios number of scenarios of the research, nothing being known of their bounds
+   */
+  void resetResearch(size_t nbScenarios);
+
   /**
    * @brief Description of a set of scenarios to run
    */
   struct task_t{
     double minVariation_;  ///< minimal variation that passes
     double maxVariation_;  ///< maximal variation that fails
+    double variation_;  ///< variation to simulate, the middle of the bracket by default
     std::vector<size_t> ids_;  ///< indexes of the scenarios to run
 
     /**
@@ -72,6 +97,7 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
     task_t(double minVariation, double maxVariation, const std::vector<size_t>& ids) {
       minVariation_ = minVariation;
       maxVariation_ = maxVariation;
+      variation_ = std::round((minVariation + maxVariation)/2.);
       ids_ = ids;
     }
 
@@ -86,6 +112,7 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
     task_t(double minVariation, double maxVariation) {
       minVariation_ = minVariation;
       maxVariation_ = maxVariation;
+      variation_ = std::round((minVariation + maxVariation)/2.);
     }
   };
 
@@ -98,7 +125,6 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
    * @param loadIncrease scenario to simulate the load increase
    * @param baseJobsFile jobs file to use as basis for the events
    * @param events list of scenarios to launch
-   * @param maximumVariationPassing maximum variation passing found so far
    * @param tolerance maximum difference between the real value of the maximum variation and the value returned
    * @param minVariation minimum variation for dichotomie
    * @param maxVariation maximum variation for dichotomie
@@ -107,7 +133,7 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
    */
   double computeGlobalMargin(const boost::shared_ptr<LoadIncrease>& loadIncrease,
       const std::string& baseJobsFile, const std::vector<boost::shared_ptr<Scenario> >& events,
-      std::vector<double >& maximumVariationPassing, double tolerance, double minVariation, double maxVariation);
+      double tolerance, double minVariation, double maxVariation);
   /**
    * @brief Research of the maximum variation value for all the scenarios
    * try to find the maximum load increase between 0 and 100% for each scenario.
@@ -127,6 +153,45 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
       const std::string& baseJobsFile, const std::vector<boost::shared_ptr<Scenario> >& events, double tolerance, double minVariation, double maxVariation,
       std::vector<double >& results);
 
+  /**
+   * @brief Read the margin of each scenario in the aggregated results of a previous run
+   *
+   * @param previousResultsFile aggregated results file of the previous run
+   * @param events list of scenarios to launch
+   */
+  void readPreviousMargins(const std::string& previousResultsFile, const std::vector<boost::shared_ptr<Scenario> >& events);
+
+  /**
+   * @brief Bracket the margins with a research whose scenarios are simulated during a shortened duration
+   *
+   * The margins found are used as previous margins of the full duration research. The load increases are shared by both researches
+   * but the status of the scenarios found by the screening are forgotten once it is over.
+   *
+   * @param loadIncrease scenario to simulate the load increase
+   * @param baseJobsFile jobs file to use as basis for the events
+   * @param events list of scenarios to launch
+   * @param tolerance maximum difference between the real value of the maximum variation and the value returned
+   * @param screeningDuration duration of the scenarios simulations of the screening
+   * @param globalMargin true if the global margin is researched
+   */
+  void screenMargins(const boost::shared_ptr<LoadIncrease>& loadIncrease, const std::string& baseJobsFile,
+      const std::vector<boost::shared_ptr<Scenario> >& events, double tolerance, double screeningDuration, bool globalMargin);
+
+  /**
+   * @brief Launch the variations around the margins of a previous run
+   *
+   * The variations one tolerance below and above the previous margin of each scenario are simulated,
+   * the bounds obtained are then used by computeGlobalMargin and computeLocalMargin as starting bracket
+   *
+   * @param loadIncrease scenario to simulate the load increase
+   * @param baseJobsFile jobs file to use as basis for the events
+   * @param events list of scenarios to launch
+   * @param tolerance maximum difference between the real value of the maximum variation and the value returned
+   * @param globalMargin true if the global margin is researched, the same previous margin is then used for all scenarios
+   */
+  void launchPreviousMarginsBrackets(const boost::shared_ptr<LoadIncrease>& loadIncrease,
+      const std::string& baseJobsFile, const std::vector<boost::shared_ptr<Scenario> >& events, double tolerance, bool globalMargin);
+
   /**
    * @brief Find if the variation load-increase was already done
    * otherwise, launch as many load increase as possible in multi-threading, including the variation one
@@ -219,9 +284,52 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
 
   /**
    * @brief Delete all temporary directories that were created to synchronize results
+   *
+   * The outputs of the results that are exported are read back before
+   *
    * @param events list of scenarios to launch
    */
-  void cleanResultDirectories(const std::vector<boost::shared_ptr<Scenario> >& events) const;
+  void cleanResultDirectories(const std::vector<boost::shared_ptr<Scenario> >& events);
+
+  /**
+   * @brief find the load levels of the results whose outputs are exported
+   *
+   * For each scenario and for the load increase, the outputs of the successful result with the highest load level
+   * and of the failed result with the lowest load level are exported
+   *
+   * Results of a load level still being launched are ignored, except for the failure of its load increase,
+   * as well as the load increase of a level decided without being simulated
+   *
+   * @param bestLoadLevels highest load level with a successful result, by scenario id
+   * @param worstLoadLevels lowest load level with a failed result, by scenario id
+   */
+  void findExportedLoadLevels(std::map<std::string, double>& bestLoadLevels, std::map<std::string, double>& worstLoadLevels) const;
+
+  /**
+   * @brief read back the outputs of the results that are exported from their save files
+   *
+   * During the search, results are kept without their outputs
+   */
+  void retainExportedOutputs();
+
+  /**
+   * @brief clear the outputs of the results which can no longer be exported
+   *
+   * Used in sequential mode, where results keep their outputs in memory: the best level of a scenario only increases
+   * and its worst level only decreases, so a result which is neither of them is never exported.
+   * The levels whose scenarios are still to be launched are left untouched, as their load increase may still become an exported one
+   */
+  void dropSupersededOutputs();
+
+  /**
+   * @brief remove the final states of the load increases whose level is out of every active research bracket
+   *
+   * The dump and IIDM files written by a load increase are only used to launch the scenarios of its level.
+   * They are zipped before being removed if the margin calculation asks for it.
+   *
+   * @param activeBrackets [min, max] brackets still researched, the levels inside one of them are kept
+   */
+  void collectLoadIncreaseStates(const std::vector<std::pair<double, double> >& activeBrackets);
 
   /**
    * @brief generates the IIDM file path for the corresponding variation
@@ -262,13 +370,156 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
    */
   std::vector<bool> synchronizeSuccesses(const std::vector<bool>& successes);
 
+  /**
+   * @brief Synchronize scenario status between all process
+   *
+   * Same as synchronizeSuccesses but keeps the complete status of each simulation
+   *
+   * @param statuses the list of status for current process
+   * @return The list of status for all procs
+   */
+  std::vector<unsigned int> synchronizeStatuses(const std::vector<unsigned int>& statuses);
+
+  /**
+   * @brief Synchronize scenario failure ratios between all process
+   *
+   * Same as synchronizeSuccesses but for the failure ratios computed by computeFailureRatio
+   *
+   * @param failureRatios the list of failure ratios for current process
+   * @return The list of failure ratios for all procs
+   */
+  std::vector<double> synchronizeFailureRatios(const std::vector<double>& failureRatios);
+
+  /**
+   * @brief Update the known bounds of a scenario with the status of a simulation
+   *
+   * A result contradicting the bounds already known (failure below a known pass or pass above a known failure) is ignored
+   *
+   * @param eventIdx index of the scenario
+   * @param variation variation of the simulation
+   * @param status status of the simulation
+   * @param failureRatio failure ratio of the simulation, see computeFailureRatio
+   */
+  void updateScenarioBounds(size_t eventIdx, double variation, status_t status, double failureRatio);
+
+  /**
+   * @brief Compute how late a scenario failed during its simulation
+   *
+   * @param result result of the simulation of the scenario
+   * @return time of the first failing criteria relatively to the duration of the scenario part, between 0 and 1,
+   * negative if the simulation did not fail on a criteria
+   */
+  double computeFailureRatio(const SimulationResult& result) const;
+
+  /**
+   * @brief Select the variation to simulate for a task of the local margin research from the failures already observed
+   *
+   * For each scenario of the task failing at the upper bound of the bracket, a late failure makes a margin close to the upper bound
+   * more likely and an early failure makes it closer to the lower bound. The selected variation is the median of the mixture of these
+   * linear densities over the bracket, so it always lies between 29% and 71% of the bracket.
+   *
+   * @param task task whose variation is selected
+   * @return variation to simulate, strictly inside the bracket of the task
+   */
+  double selectTaskVariation(const task_t& task) const;
+
+  /**
+   * @brief Check if the status of a scenario for a variation can be deduced from its known bounds
+   *
+   * @param eventIdx index of the scenario
+   * @param variation variation to check
+   * @return true if the scenario does not need to be simulated for this variation
+   */
+  bool isScenarioDecided(size_t eventIdx, double variation) const;
+
+  /**
+   * @brief Check if a scenario is known to fail for a variation
+   *
+   * @param eventIdx index of the scenario
+   * @param variation variation to check
+   * @return true if the scenario failed for this variation or below
+   */
+  bool isScenarioKnownToFail(size_t eventIdx, double variation) const;
+
+  /**
+   * @brief Fill the result of a scenario whose status is deduced from its known bounds
+   *
+   * @param eventIdx index of the scenario
+   * @param scenarioId id of the scenario
+   * @param variation variation of the result
+   * @param result result to fill
+   */
+  void fillDecidedScenarioResult(size_t eventIdx, const std::string& scenarioId, double variation, SimulationResult& result) const;
+
+  /**
+   * @brief Record the results of a load level skipped because its status is deduced from the known bounds of the scenarios
+   *
+   * The results of the scenarios decided for this level are filled as for a simulated level. The load increase of the level is not
+   * simulated: the level is flagged as decided and its result keeps the default status, without scenario id so that it is never exported
+   *
+   * @param events scenarios of the research
+   * @param variation variation of the load level
+   */
+  void recordDecidedLoadLevel(const std::vector<boost::shared_ptr<Scenario> >& events, double variation);
+
+  /**
+   * @brief Check if a scenario was already launched for a variation
+   *
+   * @param eventIdx index of the scenario
+   * @param variation variation to check
+   * @return true if the results of the scenario for this variation are available
+   */
+  bool isScenarioLaunched(size_t eventIdx, double variation) const;
+
   /**
    * @brief Computes the load increase id used in the simulation and set into the simulation result
    *
    * @param variation the variation of the scenario
    * @return the scenario id to use
    */
-  static std::string computeLoadIncreaseScenarioId(double variation);
+  std::string computeLoadIncreaseScenarioId(double variation) const;
+
+  /**
+   * @brief Computes the id of a result or of a file of the current load increase
+   *
+   * When several load increases are computed, the id of the current one is used as prefix to keep them apart
+   *
+   * @param id id shared by all load increases
+   * @return the id to use for the current load increase
+   */
+  std::string computeDirectionId(const std::string& id) const;
+
+  /**
+   * @brief Computes the id of the results of a scenario for the current load increase and research
+   *
+   * The results of the screening research are kept apart from the full duration ones
+   *
+   * @param scenarioId id of the scenario
+   * @return the id to use for the results of the scenario
+   */
+  std::string computeScenarioId(const std::string& scenarioId) const;
+
+  /**
+   * @brief Computes the directory of the events files of a scenario for the current load increase
+   *
+   * The events files do not depend on the load level: they are shared by all the simulations of the scenario
+   *
+   * @param scenarioId id of the scenario
+   * @return the directory of the events files of the scenario
+   */
+  std::string computeEventsDirectory(const std::string& scenarioId) const;
+
+  /**
+   * @brief Writes the events files of the scenarios for the current load increase
+   *
+   * The files are written by the root process before any scenario is simulated
+   *
+   * @param events scenarios whose events are written
+   */
+  void writeScenariosEventsFiles(const std::vector<boost::shared_ptr<Scenario> >& events) const;
+
+ protected:
+  std::vector<LoadIncreaseResult> results_;  ///< results of the margin calculation
 
  private:
   /**
@@ -304,16 +555,37 @@ class MarginCalculationLauncher : public RobustnessAnalysisLauncher {
 
     bool success;  ///< true if the simulation succeeds, false if not
   };
-  /// @brief Scenario status, corresponding to all scenario status for a given load increase
-  using ScenarioStatus = std::vector<LoadIncreaseStatus>;
+  /// @brief Scenario status, corresponding to the status of the scenarios launched for a given load increase, by scenario index
+  using ScenarioStatus = std::map<size_t, LoadIncreaseStatus>;
   std::map<double, LoadIncreaseStatus, dynawoDoubleLess> loadIncreaseStatus_;  ///< Map of load increase status by variation
   std::map<double, ScenarioStatus, dynawoDoubleLess> scenarioStatus_;  ///< Map of scenario status by variation
+  std::set<double, dynawoDoubleLess> collectedLoadIncreaseLevels_;  ///< load levels whose final state was removed from the working directory
 
+  /**
+   * @brief Known bounds of the margin of a scenario
+   *
+   * Margin calculation relies on the monotonicity of the scenarios with respect to the variation:
+   * a scenario passing for a variation passes below it, a scenario failing for a variation fails above it.
+   */
+  struct ScenarioBounds {
+    /// @brief default constructor: nothing is known
+    ScenarioBounds() : knownPass_(-1.), knownFail_(std::numeric_limits<double>::max()), knownFailStatus_(DIVERGENCE_STATUS), knownFailRatio_(-1.) {}
+
+    double knownPass_;  ///< highest variation for which the scenario passes, negative if none
+    double knownFail_;  ///< lowest variation for which the scenario fails
+    status_t knownFailStatus_;  ///< status of the scenario for knownFail_
+    double knownFailRatio_;  ///< failure ratio of the scenario for knownFail_, negative if unknown
+  };
+  std::vector<ScenarioBounds> scenarioBounds_;  ///< known bounds of each scenario, by scenario index
+  std::vector<double> previousMargins_;  ///< margin of each scenario in a previous run, by scenario index, negative if unknown
 
-  std::vector<LoadIncreaseResult> results_;  ///< results of the systematic analysis
+  std::map<double, SimulationResult, dynawoDoubleLess> sequentialLoadIncreaseResults_;  ///< load increase results of the sequential mode, by variation
+  std::string loadIncreaseDirection_;  ///< id of the load increase whose margin is computed, empty if there is only one
   std::map<std::string, MultiVariantInputs> inputsByIIDM_;  ///< For scenarios, the contexts to use, by IIDM file
   double tLoadIncrease_;  ///< maximum stop time for the load increase part
   double tScenario_;  ///< stop time for the scenario part
+  bool screening_;  ///< whether the scenarios are simulated for the screening research
+  bool activeLevelSelection_;  ///< whether the variation of the local margin tasks is selected from the failures already observed
 };
 }  // namespace DYNAlgorithms
 
@@ -54,6 +54,7 @@ MultiVariantInputs::readInputs(const std::string& workingDirectory, const std::s
     }
   }
   iidmPath_ = iidmFilePath;
+  dataInterface_.reset();
 }
 
 std::shared_ptr<job::JobEntry>
@@ -61,4 +62,14 @@ MultiVariantInputs::cloneJobEntry() const {
   return jobEntry_ ? std::make_shared<job::JobEntry>(*jobEntry_) : std::shared_ptr<job::JobEntry>();
 }
 
+boost::shared_ptr<DYN::DataInterface>
+MultiVariantInputs::cloneDataInterface() const {
+  if (iidmPath_.empty())
+    return boost::shared_ptr<DYN::DataInterface>();
+  if (!dataInterface_)
+    dataInterface_ = DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, iidmPath_.generic_string());
+  // each simulation modifies its network, so it gets its own copy
+  return dataInterface_->clone();
+}
+
 }  // namespace DYNAlgorithms
@@ -20,8 +20,10 @@
 #ifndef LAUNCHER_DYNMULTIVARIANTINPUTS_H_
 #define LAUNCHER_DYNMULTIVARIANTINPUTS_H_
 
+#include <DYNDataInterface.h>
 #include <JOBJobEntry.h>
 #include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
 #include <memory>
 
 
@@ -59,6 +61,15 @@ class MultiVariantInputs {
     return iidmPath_;
   }
 
+  /**
+   * @brief Retrieve a copy of the network of the IIDM file
+   *
+   * The IIDM file is only parsed by the first call, the following ones copy the network already parsed
+   *
+   * @returns network copy or null pointer if there is no IIDM file
+   */
+  boost::shared_ptr<DYN::DataInterface> cloneDataInterface() const;
+
   /**
    * @brief set maximum time duration of the variation during the load increase part
    * @param t time duration of the variation during the load increase part
@@ -78,6 +89,7 @@ class MultiVariantInputs {
  private:
   std::shared_ptr<job::JobEntry> jobEntry_;  ///< job entry to use
   boost::filesystem::path iidmPath_;         ///< IIDM path to use
+  mutable boost::shared_ptr<DYN::DataInterface> dataInterface_;  ///< network parsed from the IIDM file, null until first needed
   double tLoadIncreaseVariationMax_;         ///< maximum time duration of the variation during the load increase part
 };
 }  // namespace DYNAlgorithms
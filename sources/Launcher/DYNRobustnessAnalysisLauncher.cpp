@@ -19,13 +19,20 @@
  */
 #include "DYNRobustnessAnalysisLauncher.h"
 
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <fstream>
+#include <functional>
+#include <iomanip>
 #include <limits>
 #include <set>
+#include <sstream>
 
 #include <xml/sax/parser/ParserFactory.h>
 #include <xml/sax/parser/ParserException.h>
 #include <xml/sax/formatter/AttributeList.h>
+#include <xml/sax/formatter/Formatter.h>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/dll.hpp>
@@ -42,13 +49,14 @@
 #include <DYNFileSystemUtils.h>
 #include <DYNSimulationContext.h>
 #include <DYNExecUtils.h>
+#include <DYNModelMulti.h>
+#include <DYNSubModel.h>
 #include <JOBDynModelsEntry.h>
 #include <JOBDynModelsEntryFactory.h>
 #include <JOBModelerEntry.h>
 #include <JOBSimulationEntryFactory.h>
 #include <JOBJobsCollection.h>
 #include <DYNMacrosMessage.h>
-#include <DYNDataInterfaceFactory.h>
 #include <DYNTrace.h>
 #include <DYNCommon.h>
 
@@ -59,6 +67,9 @@
 #include "../gitversion_algorithms.h"
 #include "DYNMultipleJobsXmlHandler.h"
 #include "DYNMultipleJobs.h"
+#include "DYNScenario.h"
+#include "DYNSteadyStateDetection.h"
+#include "DYNInstabilityDetection.h"
 #include "MacrosMessage.h"
 #include "DYNMultiProcessingContext.h"
 
@@ -66,6 +77,9 @@
 using DYN::Trace;
 using multipleJobs::MultipleJobs;
 
+static const char EVENT_MODELS_ENV_VAR[] = "DYNAWO_ALGORITHMS_EVENT_MODELS";  ///< additional event models whose event time is handled
+static const unsigned int STEADY_STATE_SAMPLES_BY_WINDOW = 10;  ///< number of samples of the monitored variables over a steady state window
+
 namespace DYNAlgorithms {
 
 RobustnessAnalysisLauncher::RobustnessAnalysisLauncher() :
@@ -258,21 +272,65 @@ RobustnessAnalysisLauncher::unzipAndGetMultipleJobsFileName(const std::string& i
 
 boost::shared_ptr<MultipleJobs>
 RobustnessAnalysisLauncher::readInputData(const std::string& fileName) {
+  // the file is read and validated by the root process only, the other processes parse the validated content it broadcasts
+  auto& context = multiprocessing::context();
+  std::string content;
+  bool parsingFailed = false;
+  std::string parsingError;
+  std::exception_ptr rootError;
+  boost::shared_ptr<MultipleJobs> multipleJobs;
+  if (context.isRootProc()) {
+    // any error is only thrown once the other processes know about it, for them not to wait for the content forever
+    try {
+      std::ifstream file(fileName.c_str(), std::ios::binary);
+      std::stringstream fileContent;
+      fileContent << file.rdbuf();
+      content = fileContent.str();
+      multipleJobs = parseInputData(content, getEnvVar("DYNAWO_USE_XSD_VALIDATION") == "true");
+    } catch (const xml::sax::parser::ParserException& exp) {
+      parsingFailed = true;
+      parsingError = exp.what();
+    } catch (const std::exception& exp) {
+      parsingFailed = true;
+      parsingError = exp.what();
+      rootError = std::current_exception();
+    } catch (...) {
+      parsingFailed = true;
+      parsingError = "unknown error";
+      rootError = std::current_exception();
+    }
+  }
+  context.broadcast(parsingFailed);
+  if (parsingFailed) {
+    context.broadcast(parsingError);
+    // the root process throws its own error, the other processes report it as a parsing error
+    if (rootError)
+      std::rethrow_exception(rootError);
+    throw DYNAlgorithmsError(XmlParsingError, fileName, parsingError);
+  }
+  context.broadcast(content);
+  if (!context.isRootProc()) {
+    try {
+      multipleJobs = parseInputData(content, false);
+    } catch (const xml::sax::parser::ParserException& exp) {
+      throw DYNAlgorithmsError(XmlParsingError, fileName, exp.what());
+    }
+  }
+  return multipleJobs;
+}
+
+boost::shared_ptr<MultipleJobs>
+RobustnessAnalysisLauncher::parseInputData(const std::string& content, bool xsdValidation) {
   multipleJobs::XmlHandler multipleJobsHandler;
 
   xml::sax::parser::ParserFactory parserFactory;
   xml::sax::parser::ParserPtr parser = parserFactory.createParser();
-  bool xsdValidation = false;
-  if (getEnvVar("DYNAWO_USE_XSD_VALIDATION") == "true") {
+  if (xsdValidation) {
     const std::string xsdPath = createAbsolutePath("multipleJobs.xsd", getMandatoryEnvVar("DYNAWO_ALGORITHMS_XSD_DIR"));
     parser->addXmlSchema(xsdPath);
-    xsdValidation = true;
-  }
-  try {
-    parser->parse(fileName, multipleJobsHandler, xsdValidation);
-  }  catch (const xml::sax::parser::ParserException& exp) {
-    throw DYNAlgorithmsError(XmlParsingError, fileName, exp.what());
   }
+  std::istringstream stream(content);
+  parser->parse(stream, multipleJobsHandler, xsdValidation);
   return multipleJobsHandler.getMultipleJobs();
 }
 
@@ -285,6 +343,111 @@ RobustnessAnalysisLauncher::addDydFileToJob(const std::shared_ptr<job::JobEntry>
   }
 }
 
+/**
+ * @brief Add a parameter to a set of a par file
+ * @param formatter formatter of the par file
+ * @param type type of the parameter
+ * @param name name of the parameter
+ * @param value value of the parameter
+ */
+static void
+addParameter(xml::sax::formatter::FormatterPtr& formatter, const std::string& type, const std::string& name, const std::string& value) {
+  xml::sax::formatter::AttributeList attrs;
+  attrs.add("type", type);
+  attrs.add("name", name);
+  attrs.add("value", value);
+  formatter->startElement("par", attrs);
+  formatter->endElement();  // par
+}
+
+void
+RobustnessAnalysisLauncher::addEventsToJob(const std::shared_ptr<job::JobEntry>& job, const boost::shared_ptr<Scenario>& scenario,
+    const std::string& workingDir) {
+  if (scenario->getEvents().empty())
+    return;
+  writeEventsFiles(scenario, workingDir);
+  addDydFileToJob(job, computeEventsDydFile(workingDir));
+}
+
+std::string
+RobustnessAnalysisLauncher::computeEventsDydFile(const std::string& workingDir) const {
+  return createAbsolutePath("events.dyd", workingDir);
+}
+
+void
+RobustnessAnalysisLauncher::writeEventsFiles(const boost::shared_ptr<Scenario>& scenario, const std::string& workingDir) const {
+  const std::vector<Scenario::Event>& events = scenario->getEvents();
+  if (events.empty())
+    return;
+  if (!exists(workingDir))
+    createDirectory(workingDir);
+  const std::string dydFile = computeEventsDydFile(workingDir);
+  const std::string parFile = createAbsolutePath("events.par", workingDir);
+  std::ofstream dydStream(dydFile.c_str());
+  if (!dydStream.is_open())
+    throw DYNAlgorithmsError(FileGenerationFailed, dydFile);
+  std::ofstream parStream(parFile.c_str());
+  if (!parStream.is_open())
+    throw DYNAlgorithmsError(FileGenerationFailed, parFile);
+
+  xml::sax::formatter::FormatterPtr dyd = xml::sax::formatter::Formatter::createFormatter(dydStream, "http://www.rte-france.com/dynawo");
+  xml::sax::formatter::FormatterPtr par = xml::sax::formatter::Formatter::createFormatter(parStream, "http://www.rte-france.com/dynawo");
+  xml::sax::formatter::AttributeList attrs;
+  dyd->startDocument();
+  dyd->startElement("dynamicModelsArchitecture", attrs);
+  par->startDocument();
+  par->startElement("parametersSet", attrs);
+  for (unsigned int i = 0; i < events.size(); ++i) {
+    const Scenario::Event& event = events[i];
+    std::stringstream modelId;
+    modelId << "EVENT_" << i << "_" << event.elementId_;
+    attrs.clear();
+    attrs.add("id", modelId.str());
+    attrs.add("lib", event.type_ == Scenario::Event::BRANCH_DISCONNECTION ? "EventQuadripoleDisconnection" : "EventConnectedStatus");
+    attrs.add("parFile", parFile);
+    attrs.add("parId", modelId.str());
+    dyd->startElement("blackBoxModel", attrs);
+    dyd->endElement();  // blackBoxModel
+    attrs.clear();
+    attrs.add("id1", modelId.str());
+    attrs.add("var1", "event_state1_value");
+    // the state of the element in the network model, unless another connection is given in the multiple jobs file
+    attrs.add("id2", event.modelId_.empty() ? "NETWORK" : event.modelId_);
+    attrs.add("var2", event.variable_.empty() ? event.elementId_ + "_state_value" : event.variable_);
+    dyd->startElement("connect", attrs);
+    dyd->endElement();  // connect
+
+    attrs.clear();
+    attrs.add("id", modelId.str());
+    par->startElement("set", attrs);
+    std::set<std::string> givenParameters;
+    for (const auto& parameter : event.parameters_) {
+      addParameter(par, parameter.type_, parameter.name_, parameter.value_);
+      givenParameters.insert(parameter.name_);
+    }
+    // default parameters of the event model, unless given in the multiple jobs file
+    std::stringstream time;
+    time << std::setprecision(15) << event.time_;
+    std::vector<std::pair<std::string, std::string> > defaultParameters;
+    defaultParameters.push_back(std::make_pair("event_tEvent", time.str()));
+    if (event.type_ == Scenario::Event::BRANCH_DISCONNECTION) {
+      defaultParameters.push_back(std::make_pair("event_disconnectOrigin", "true"));
+      defaultParameters.push_back(std::make_pair("event_disconnectExtremity", "true"));
+    } else {
+      defaultParameters.push_back(std::make_pair("event_open", "true"));
+    }
+    for (const auto& parameter : defaultParameters) {
+      if (givenParameters.count(parameter.first) == 0)
+        addParameter(par, parameter.first == "event_tEvent" ? "DOUBLE" : "BOOL", parameter.first, parameter.second);
+    }
+    par->endElement();  // set
+  }
+  par->endElement();  // parametersSet
+  par->endDocument();
+  dyd->endElement();  // dynamicModelsArchitecture
+  dyd->endDocument();
+}
+
 void
 RobustnessAnalysisLauncher::setCriteriaFileForJob(const std::shared_ptr<job::JobEntry>& job, const std::string& criteriaFile) {
   if (!criteriaFile.empty()) {
@@ -301,9 +464,7 @@ RobustnessAnalysisLauncher::createAndInitSimulation(const std::string& workingDi
   context->setInputDirectory(workingDirectory_);
   context->setWorkingDirectory(workingDir);
 
-  boost::shared_ptr<DYN::DataInterface> dataInterface = !analysisContext.iidmPath().empty()
-    ? DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, analysisContext.iidmPath().generic_string())
-    : boost::shared_ptr<DYN::DataInterface>();
+  boost::shared_ptr<DYN::DataInterface> dataInterface = analysisContext.cloneDataInterface();
 
   boost::shared_ptr<DYN::Simulation> simulation =
     boost::shared_ptr<DYN::Simulation>(new DYN::Simulation(job, std::move(context), dataInterface));
@@ -387,12 +548,27 @@ RobustnessAnalysisLauncher::createAndInitSimulation(const std::string& workingDi
 }
 
 status_t
-RobustnessAnalysisLauncher::simulate(const boost::shared_ptr<DYN::Simulation>& simulation, SimulationResult& result) {
+RobustnessAnalysisLauncher::simulate(const boost::shared_ptr<DYN::Simulation>& simulation, SimulationResult& result, double lastEventTime,
+    bool retainOutputs) {
   try {
-      simulation->simulate();
+      bool unstable = false;
+      if (instabilityDetection_ && lastEventTime >= 0.)
+        unstable = simulateUntilInstability(simulation, lastEventTime, result);
+      else if (steadyStateDetection_ && lastEventTime >= 0.)
+        simulateUntilSteadyState(simulation, lastEventTime, result);
+      else
+        simulation->simulate();
       simulation->terminate();
-      result.setSuccess(true);
-      result.setStatus(CONVERGENCE_STATUS);
+      result.setSuccess(!unstable);
+      if (unstable) {
+        // the instability is reported as a failing criterion so that the failure time is known as for the other failures
+        result.setStatus(CRITERIA_NON_RESPECTED_STATUS);
+        std::vector<std::pair<double, std::string> > failingCriteria;
+        failingCriteria.push_back(std::make_pair(result.getInstabilityTime(), result.getInstabilityReason()));
+        result.setFailingCriteria(failingCriteria);
+      } else {
+        result.setStatus(CONVERGENCE_STATUS);
+      }
     } catch (const DYN::Error& e) {
       std::cerr << e.what() << std::endl;
       Trace::error() << e.what() << Trace::endline;
@@ -443,13 +619,168 @@ RobustnessAnalysisLauncher::simulate(const boost::shared_ptr<DYN::Simulation>& s
       result.setSuccess(false);
       result.setStatus(EXECUTION_PROBLEM_STATUS);
     }
-    simulation->printTimeline(result.getTimelineStream());
-    simulation->printConstraints(result.getConstraintsStream());
-    simulation->printLostEquipments(result.getLostEquipementsStream());
-    simulation->dumpIIDMFile(result.getOutputIIDMStream());
+    if (retainOutputs) {
+      simulation->printTimeline(result.getTimelineStream());
+      simulation->printConstraints(result.getConstraintsStream());
+      simulation->printLostEquipments(result.getLostEquipementsStream());
+      simulation->dumpIIDMFile(result.getOutputIIDMStream());
+    }
     return result.getStatus();
 }
 
+void
+RobustnessAnalysisLauncher::simulateUntilSteadyState(const boost::shared_ptr<DYN::Simulation>& simulation, double lastEventTime,
+    SimulationResult& result) const {
+  std::shared_ptr<DYN::ModelMulti> modelMulti = std::dynamic_pointer_cast<DYN::ModelMulti>(simulation->getModel());
+  std::vector<std::function<double()> > monitoredVariables;
+  for (const auto& variable : steadyStateDetection_->getVariables()) {
+    auto subModel = modelMulti->findSubModelByName(variable.first);
+    if (!subModel || !subModel->hasVariable(variable.second)) {
+      Trace::warn() << DYNAlgorithmsLog(SteadyStateVariableNotFound, variable.first, variable.second) << Trace::endline;
+      simulation->simulate();
+      return;
+    }
+    auto modelVariable = subModel->getVariable(variable.second);
+    monitoredVariables.push_back([subModel, modelVariable]() { return subModel->getVariableValue(modelVariable); });
+  }
+  if (monitoredVariables.empty()) {
+    simulation->simulate();
+    return;
+  }
+
+  // the simulation is run window by window after the last event and the monitored variables are sampled along each window:
+  // the range of their samples over the window is compared to the threshold, so that an oscillation is not taken for a steady state
+  const double stopTime = simulation->getStopTime();
+  const double sampling = steadyStateDetection_->getWindow() / STEADY_STATE_SAMPLES_BY_WINDOW;
+  const double threshold = steadyStateDetection_->getThreshold();
+  const double firstTime = std::max(lastEventTime, simulation->getStartTime());
+  std::vector<double> minValues;
+  std::vector<double> maxValues;
+  for (unsigned int sample = 1; firstTime + sample * sampling < stopTime; ++sample) {
+    const double sampleTime = firstTime + sample * sampling;
+    simulation->setStopTime(sampleTime);
+    simulation->simulate();
+    std::vector<double> values;
+    for (const auto& monitoredVariable : monitoredVariables)
+      values.push_back(monitoredVariable());
+    if (minValues.empty()) {
+      minValues = values;
+      maxValues = values;
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+      minValues[i] = std::min(minValues[i], values[i]);
+      maxValues[i] = std::max(maxValues[i], values[i]);
+    }
+    if (sample % STEADY_STATE_SAMPLES_BY_WINDOW != 0)
+      continue;
+    bool steadyState = true;
+    for (size_t i = 0; i < values.size() && steadyState; ++i)
+      steadyState = maxValues[i] - minValues[i] <= threshold;
+    if (steadyState) {
+      Trace::info() << DYNAlgorithmsLog(SteadyStateReached, sampleTime, stopTime) << Trace::endline;
+      result.setSteadyStateTime(sampleTime);
+      return;
+    }
+    // the next window starts from the values at the end of this one
+    minValues = values;
+    maxValues = values;
+  }
+  simulation->setStopTime(stopTime);
+  simulation->simulate();
+}
+
+bool
+RobustnessAnalysisLauncher::simulateUntilInstability(const boost::shared_ptr<DYN::Simulation>& simulation, double lastEventTime,
+    SimulationResult& result) const {
+  std::shared_ptr<DYN::ModelMulti> modelMulti = std::dynamic_pointer_cast<DYN::ModelMulti>(simulation->getModel());
+  std::vector<std::function<double()> > monitoredVariables;
+  for (const auto& variable : instabilityDetection_->getVariables()) {
+    auto subModel = modelMulti->findSubModelByName(variable.modelId_);
+    if (!subModel || !subModel->hasVariable(variable.variableName_)) {
+      Trace::warn() << DYNAlgorithmsLog(InstabilityVariableNotFound, variable.modelId_, variable.variableName_) << Trace::endline;
+      simulation->simulate();
+      return false;
+    }
+    auto modelVariable = subModel->getVariable(variable.variableName_);
+    monitoredVariables.push_back([subModel, modelVariable]() { return subModel->getVariableValue(modelVariable); });
+  }
+  if (monitoredVariables.empty()) {
+    simulation->simulate();
+    return false;
+  }
+
+  // the simulation is run window by window after the last event and the monitored variables are checked at the end of each window
+  const std::vector<InstabilityDetection::Variable>& variables = instabilityDetection_->getVariables();
+  const double stopTime = simulation->getStopTime();
+  const double window = instabilityDetection_->getWindow();
+  for (double checkTime = std::max(lastEventTime, simulation->getStartTime()) + window; checkTime < stopTime; checkTime += window) {
+    simulation->setStopTime(checkTime);
+    simulation->simulate();
+    for (size_t i = 0; i < monitoredVariables.size(); ++i) {
+      const double value = monitoredVariables[i]();
+      if (value >= variables[i].minValue_ && value <= variables[i].maxValue_)
+        continue;
+      std::stringstream reason;
+      reason << variables[i].modelId_ << " " << variables[i].variableName_ << (value > variables[i].maxValue_ ? " above " : " below ")
+          << (value > variables[i].maxValue_ ? variables[i].maxValue_ : variables[i].minValue_);
+      Trace::info() << DYNAlgorithmsLog(InstabilityDetected, variables[i].variableName_, variables[i].modelId_, value, checkTime) << Trace::endline;
+      result.setInstability(checkTime, reason.str());
+      return true;
+    }
+  }
+  simulation->setStopTime(stopTime);
+  simulation->simulate();
+  return false;
+}
+
+const std::vector<std::string>&
+RobustnessAnalysisLauncher::getEventModelsLibs() {
+  if (eventModelsLibs_.empty()) {
+    // event models really used by the scenarios, completed by the ones given through the environment
+    std::vector<std::string> eventModels = {"EventQuadripoleDisconnection", "EventConnectedStatus", "EventSetPointBoolean", "SetPoint",
+        "EventSetPointReal", "EventSetPointDoubleReal", "EventSetPointGenerator", "EventSetPointLoad", "LineTrippingEvent",
+        "TfoTrippingEvent", "EventQuadripoleConnection"};
+    const std::string additionalEventModels = getEnvVar(EVENT_MODELS_ENV_VAR);
+    if (!additionalEventModels.empty()) {
+      std::vector<std::string> additionalEventModelsList;
+      boost::split(additionalEventModelsList, additionalEventModels, boost::is_any_of(",:"), boost::token_compress_on);
+      for (const auto& eventModel : additionalEventModelsList) {
+        const std::string trimmedEventModel = boost::trim_copy(eventModel);
+        if (!trimmedEventModel.empty() && std::find(eventModels.begin(), eventModels.end(), trimmedEventModel) == eventModels.end())
+          eventModels.push_back(trimmedEventModel);
+      }
+    }
+    const std::string DDBDir = getMandatoryEnvVar("DYNAWO_DDB_DIR");
+    for (const auto& eventModel : eventModels)
+      eventModelsLibs_.push_back(createAbsolutePath(eventModel + DYN::sharedLibraryExtension(), DDBDir));
+  }
+  return eventModelsLibs_;
+}
+
+const std::vector<std::string>&
+RobustnessAnalysisLauncher::findEventSubModels(const boost::shared_ptr<DYN::Simulation>& simulation, const std::string& scenarioId) {
+  auto eventSubModels = eventSubModelsByScenario_.find(scenarioId);
+  if (eventSubModels == eventSubModelsByScenario_.end()) {
+    std::shared_ptr<DYN::ModelMulti> modelMulti = std::dynamic_pointer_cast<DYN::ModelMulti>(simulation->getModel());
+    std::vector<std::string> subModelsNames;
+    for (const auto& eventModelLib : getEventModelsLibs()) {
+      for (const auto& subModel : modelMulti->findSubModelByLib(eventModelLib))
+        subModelsNames.push_back(subModel->name());
+    }
+    eventSubModels = eventSubModelsByScenario_.emplace(scenarioId, subModelsNames).first;
+  }
+  return eventSubModels->second;
+}
+
+double
+RobustnessAnalysisLauncher::getLastEventTime(const boost::shared_ptr<DYN::Simulation>& simulation, const std::string& scenarioId) {
+  std::shared_ptr<DYN::ModelMulti> modelMulti = std::dynamic_pointer_cast<DYN::ModelMulti>(simulation->getModel());
+  double lastEventTime = simulation->getStartTime();
+  for (const auto& subModelName : findEventSubModels(simulation, scenarioId))
+    lastEventTime = std::max(lastEventTime, modelMulti->findSubModelByName(subModelName)->findParameterDynamic("event_tEvent").getValue<double>());
+  return lastEventTime;
+}
+
 void
 RobustnessAnalysisLauncher::storeOutputs(const SimulationResult& result, std::map<std::string, std::string>& mapData) const {
 #ifndef NDEBUG
@@ -603,7 +934,7 @@ RobustnessAnalysisLauncher::computeResultFile(const std::string& id) const {
 }
 
 SimulationResult
-RobustnessAnalysisLauncher::importResult(const std::string& id) const {
+RobustnessAnalysisLauncher::importResult(const std::string& id, bool withOutputs) const {
   auto filepath = computeResultFile(id);
   SimulationResult ret;
   const char delimiter = ':';
@@ -642,7 +973,8 @@ RobustnessAnalysisLauncher::importResult(const std::string& id) const {
       // case no timeline
       break;
     }
-    timeline << tmpStr << std::endl;
+    if (withOutputs)
+      timeline << tmpStr << std::endl;
   }
 
   // constraints
@@ -653,7 +985,8 @@ RobustnessAnalysisLauncher::importResult(const std::string& id) const {
       // case no constraints
       break;
     }
-    constraints << tmpStr << std::endl;
+    if (withOutputs)
+      constraints << tmpStr << std::endl;
   }
 
   // lost equipments
@@ -664,7 +997,8 @@ RobustnessAnalysisLauncher::importResult(const std::string& id) const {
       // case no lost equipments
       break;
     }
-    lostEquipments << tmpStr << std::endl;
+    if (withOutputs)
+      lostEquipments << tmpStr << std::endl;
   }
 
   // outputIIDM
@@ -675,7 +1009,8 @@ RobustnessAnalysisLauncher::importResult(const std::string& id) const {
       // case no output IIDM
       break;
     }
-    outputIIDM << tmpStr << std::endl;
+    if (withOutputs)
+      outputIIDM << tmpStr << std::endl;
   }
 
   // variation
@@ -729,6 +1064,26 @@ RobustnessAnalysisLauncher::importResult(const std::string& id) const {
   logPath = logPath.substr(logPath.find(delimiter)+1);
   ret.setLogPath(logPath);
 
+  // steady state
+  double steadyStateTime;
+  file >> tmpStr;
+  assert(tmpStr.find("steadyState:") == 0);
+  tmpStr = tmpStr.substr(tmpStr.find(delimiter)+1);
+  ss.clear();
+  ss.str(tmpStr);
+  ss >> steadyStateTime;
+  ret.setSteadyStateTime(steadyStateTime);
+
+  // screening
+  bool screening;
+  file >> tmpStr;
+  assert(tmpStr.find("screening:") == 0);
+  tmpStr = tmpStr.substr(tmpStr.find(delimiter)+1);
+  ss.clear();
+  ss.str(tmpStr);
+  ss >> std::boolalpha >> screening;
+  ret.setScreening(screening);
+
   // criteria
   file >> tmpStr;
   assert(tmpStr == "criteria:");
@@ -770,6 +1125,8 @@ RobustnessAnalysisLauncher::exportResult(const SimulationResult& result) const {
   file << "constraints extension:" << result.getConstraintsFileExtension() << std::endl;
   file << "lostEquipments extension:" << result.getLostEquipmentsFileExtension() << std::endl;
   file << "log:" << result.getLogPath() << std::endl;
+  file << "steadyState:" << result.getSteadyStateTime() << std::endl;
+  file << "screening:" << std::boolalpha << result.isScreening() << std::endl;
   file << "criteria:" << std::endl;
   for (const auto& criteria : result.getFailingCriteria()) {
     file << criteria.first << ":" << criteria.second << std::endl;
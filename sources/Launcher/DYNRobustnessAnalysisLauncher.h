@@ -22,6 +22,8 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <memory>
 #include <boost/shared_ptr.hpp>
 #include <boost/filesystem.hpp>
@@ -38,6 +40,10 @@ class MultipleJobs;
 }
 
 namespace DYNAlgorithms {
+class Scenario;
+class SteadyStateDetection;
+class InstabilityDetection;
+
 /**
  * @brief Robustness analysis launcher class
  *
@@ -148,6 +154,34 @@ class RobustnessAnalysisLauncher {
    */
   void addDydFileToJob(const std::shared_ptr<job::JobEntry>& job, const std::string& dydFile);
 
+  /**
+   * @brief add the events of a scenario given in the multiple jobs file to the job
+   *
+   * The events are expanded into event models written in a dyd file and a par file of the working directory of the scenario
+   *
+   * @param job job to simulate
+   * @param scenario scenario whose events are added
+   * @param workingDir working directory of the scenario
+   */
+  void addEventsToJob(const std::shared_ptr<job::JobEntry>& job, const boost::shared_ptr<Scenario>& scenario, const std::string& workingDir);
+
+  /**
+   * @brief write the event models of a scenario given in the multiple jobs file in a dyd file and a par file
+   *
+   * Nothing is written when the scenario has no event
+   *
+   * @param scenario scenario whose events are written
+   * @param workingDir directory where the files are written
+   */
+  void writeEventsFiles(const boost::shared_ptr<Scenario>& scenario, const std::string& workingDir) const;
+
+  /**
+   * @brief compute the path of the dyd file of the events written in a directory
+   * @param workingDir directory where the events files are written
+   * @return the path of the dyd file of the events
+   */
+  std::string computeEventsDydFile(const std::string& workingDir) const;
+
   /**
    * @brief replace the criteria file for the job
    * @param job job to simulate
@@ -157,12 +191,48 @@ class RobustnessAnalysisLauncher {
 
   /**
    * @brief launch a simulation and collect results
+   *
+   * When a steady state detection is defined and the time of the last event is given, the simulation
+   * is stopped as soon as a steady state is reached after this event
+   *
    * @param simulation the simulation to launch
    * @param result will be filled with simulation results after call
+   * @param lastEventTime time of the last event of the scenario, negative to always simulate until the stop time
+   * @param retainOutputs if false, the timeline, constraints, lost equipments and final state IIDM are not printed in the result
    *
    * @return simulation result
    */
-  status_t simulate(const boost::shared_ptr<DYN::Simulation>& simulation, SimulationResult& result);
+  status_t simulate(const boost::shared_ptr<DYN::Simulation>& simulation, SimulationResult& result, double lastEventTime = -1.,
+      bool retainOutputs = true);
+
+  /**
+   * @brief get the libraries of the event models of the scenarios
+   *
+   * The built-in list is completed by the model names given in the DYNAWO_ALGORITHMS_EVENT_MODELS
+   * environment variable (separated by ',' or ':')
+   *
+   * @return absolute paths of the event models libraries
+   */
+  const std::vector<std::string>& getEventModelsLibs();
+
+  /**
+   * @brief find the event submodels of a scenario in its simulation
+   *
+   * The submodels of a scenario do not depend on its simulation: they are looked for by library only once per scenario
+   *
+   * @param simulation a simulation of the scenario
+   * @param scenarioId id of the scenario
+   * @return names of the event submodels of the scenario
+   */
+  const std::vector<std::string>& findEventSubModels(const boost::shared_ptr<DYN::Simulation>& simulation, const std::string& scenarioId);
+
+  /**
+   * @brief get the time of the last event of a simulation
+   * @param simulation the simulation to look into
+   * @param scenarioId id of the scenario of the simulation
+   * @return time of the last event of the simulation, its start time if it has no event
+   */
+  double getLastEventTime(const boost::shared_ptr<DYN::Simulation>& simulation, const std::string& scenarioId);
 
   /**
    * @brief store outputs file contents for a result in a container
@@ -198,9 +268,10 @@ class RobustnessAnalysisLauncher {
    * @brief Import simulation result from a save file
    *
    * @param id the scenario id
+   * @param withOutputs if false, the timeline, constraints, lost equipments and final state IIDM are skipped
    * @return SimulationResult from this scenario
    */
-  SimulationResult importResult(const std::string& id) const;
+  SimulationResult importResult(const std::string& id, bool withOutputs = true) const;
 
   /**
    * @brief Clean from disk everything that was created for synchronization
@@ -222,6 +293,15 @@ class RobustnessAnalysisLauncher {
    */
   boost::filesystem::path computeResultFile(const std::string& id) const;
 
+  /**
+   * parse the content of an input file
+   * @param content content of the input file
+   * @param xsdValidation whether the content is validated against the multiple jobs schema
+   *
+   * @return the multiple jobs instance create thanks to input data
+   */
+  static boost::shared_ptr<multipleJobs::MultipleJobs> parseInputData(const std::string& content, bool xsdValidation);
+
  protected:
   const std::string logTag_;  ///< tag string in dynawo.log
   std::string inputFile_;  ///< input data for the analysis
@@ -232,10 +312,35 @@ class RobustnessAnalysisLauncher {
   boost::shared_ptr<multipleJobs::MultipleJobs> multipleJobs_;  ///< multipleJobs description tu use for the systematic analysis
 
   MultiVariantInputs inputs_;  ///< basic analysis context, common to all
+  boost::shared_ptr<SteadyStateDetection> steadyStateDetection_;  ///< steady state detection used to end scenarios simulations early, null if not used
+  boost::shared_ptr<InstabilityDetection> instabilityDetection_;  ///< instability detection used to end failing scenarios simulations early, null if not used
 
   static constexpr int precisionResultFile_ = std::numeric_limits<double>::max_digits10;  ///< precision of double in save results files
 
  private:
+  /**
+   * @brief run a simulation until a steady state is reached after its last event or until its stop time
+   *
+   * The simulation is resumed sample after sample by moving its stop time forward before each call to simulate()
+   *
+   * @param simulation the simulation to run
+   * @param lastEventTime time of the last event of the scenario
+   * @param result filled with the time at which the simulation was stopped if a steady state was reached
+   */
+  void simulateUntilSteadyState(const boost::shared_ptr<DYN::Simulation>& simulation, double lastEventTime, SimulationResult& result) const;
+
+  /**
+   * @brief run a simulation until a monitored variable leaves its bounds after its last event or until its stop time
+   *
+   * The simulation is resumed window after window by moving its stop time forward before each call to simulate()
+   *
+   * @param simulation the simulation to run
+   * @param lastEventTime time of the last event of the scenario
+   * @param result filled with the time and the reason of the instability if one was detected
+   * @return @b true if the simulation was stopped on instability, @b false otherwise
+   */
+  bool simulateUntilInstability(const boost::shared_ptr<DYN::Simulation>& simulation, double lastEventTime, SimulationResult& result) const;
+
   /**
    * @brief Find in the final state entries if the final state IIDM export is required
    *
@@ -260,6 +365,10 @@ class RobustnessAnalysisLauncher {
 
   /**
    * read the input data for launching the systematic analysis
+   *
+   * The file is read and validated by the root process, which broadcasts its content to the other processes.
+   * An error of the root process is broadcast too, and thrown by all the processes
+   *
    * @param fileName path to the input file
    *
    * @return the multiple jobs instance create thanks to input data
@@ -273,6 +382,10 @@ class RobustnessAnalysisLauncher {
    * @return the full path of the unzipped file containing the multiple jobs definition
    */
   std::string unzipAndGetMultipleJobsFileName(const std::string& inputFileFullPath) const;
+
+ private:
+  std::vector<std::string> eventModelsLibs_;  ///< libraries of the event models of the scenarios
+  std::unordered_map<std::string, std::vector<std::string> > eventSubModelsByScenario_;  ///< names of the event submodels, by scenario id
 };
 
 }  // namespace DYNAlgorithms
@@ -20,10 +20,14 @@
 
 #include "DYNSystematicAnalysisLauncher.h"
 
+#include <algorithm>
 #include <limits>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <numeric>
+#include <set>
+#include <sstream>
 
 #include <boost/shared_ptr.hpp>
 #include "boost/date_time/posix_time/posix_time.hpp"
@@ -40,13 +44,27 @@
 #include <JOBXmlImporter.h>
 #include <JOBJobsCollection.h>
 #include <JOBJobEntry.h>
+#include <JOBDynModelsEntry.h>
+#include <JOBInitialStateEntry.h>
+#include <JOBModelerEntry.h>
+#include <JOBNetworkEntry.h>
+#include <JOBSolverEntry.h>
 #include <JOBOutputsEntry.h>
+#include <JOBSimulationEntry.h>
 #include <JOBTimelineEntry.h>
+#include <DYDXmlImporter.h>
+#include <DYDDynamicModelsCollection.h>
+#include <DYDBlackBoxModel.h>
+#include <DYDModelicaModel.h>
+#include <DYDModelTemplateExpansion.h>
+#include <DYDUnitDynamicModel.h>
 #include <DYNTrace.h>
 
 #include "DYNMultipleJobs.h"
 #include "DYNScenarios.h"
 #include "DYNScenario.h"
+#include "DYNSteadyStateDetection.h"
+#include "DYNInputsHash.h"
 #include "DYNSimulationResult.h"
 #include "DYNAggrResXmlExporter.h"
 #include "MacrosMessage.h"
@@ -60,6 +78,29 @@ static DYN::TraceStream TraceInfo(const std::string& tag = "") {
   return multiprocessing::context().isRootProc() ? Trace::info(tag) : DYN::TraceStream();
 }
 
+/**
+ * @brief Compute the id of the screening result of a scenario simulated again until the stop time of the job
+ * @param scenarioId id of the scenario
+ * @return the id of the screening result of the scenario
+ */
+static std::string
+computeScreeningScenarioId(const std::string& scenarioId) {
+  return scenarioId + "_screening";
+}
+
+/**
+ * @brief Compute the path of the partial results file of a process
+ * @param outputFile path of the aggregated results file
+ * @param rank rank of the process
+ * @return the path of the file the results of the scenarios simulated by the process are appended to
+ */
+static std::string
+computePartialResultsFile(const std::string& outputFile, unsigned int rank) {
+  std::stringstream partialResultsFile;
+  partialResultsFile << outputFile << "." << rank << ".partial";
+  return partialResultsFile.str();
+}
+
 void
 SystematicAnalysisLauncher::launch() {
   boost::posix_time::ptime t0 = boost::posix_time::second_clock::local_time();
@@ -69,13 +110,18 @@ SystematicAnalysisLauncher::launch() {
   }
   const std::string& baseJobsFile = scenarios->getJobsFile();
   const std::vector<boost::shared_ptr<Scenario> >& events = scenarios->getScenarios();
+  steadyStateDetection_ = scenarios->getSteadyStateDetection();
 
   auto& context = multiprocessing::context();
 
-  if (context.isRootProc()) {
-    // only required for root proc
-    results_.resize(events.size());
-  }
+  results_.clear();
+  unsigned int rank = 0;
+#ifdef _MPI_
+  rank = context.rank();
+#endif
+  partialResultsFile_ = computePartialResultsFile(outputFileFullPath_, rank);
+  if (exists(partialResultsFile_))
+    remove(partialResultsFile_);
 
   multiprocessing::forEach(0, events.size(), [this, &events](unsigned int i){
     std::string workingDir  = createAbsolutePath(events[i]->getId(), workingDirectory_);
@@ -86,19 +132,98 @@ SystematicAnalysisLauncher::launch() {
   });
 
   inputs_.readInputs(workingDirectory_, baseJobsFile);
+  initialStateFile_.clear();
+  if (scenarios->getInitialization() != Scenarios::INIT_EACH_SCENARIO)
+    launchSharedInitialization(baseJobsFile, scenarios->getInitialization());
 
-  multiprocessing::forEach(0, events.size(), [this, &events](unsigned int i){
-      auto result = launchScenario(events[i]);
+  // only the scenarios whose inputs changed since they were cached are simulated
+  std::string baseInputsHash;
+  resultsCacheDirectory_.clear();
+  if (!scenarios->getResultsCacheDirectory().empty()) {
+    resultsCacheDirectory_ = createAbsolutePath(scenarios->getResultsCacheDirectory(), workingDirectory_);
+    baseInputsHash = computeBaseInputsHash(baseJobsFile, scenarios);
+  }
+  const double screeningDuration = scenarios->getScreeningDuration();
+  if (screeningDuration > 0.)
+    TraceInfo(logTag_) << DYNAlgorithmsLog(ScreeningScenariosStart, screeningDuration) << Trace::endline;
+  unsigned int nbCachedResults = 0;
+  unsigned int nbScreenedOutResults = 0;
+  multiprocessing::forEach(0, events.size(), [this, &events, &scenarios, &baseInputsHash, &nbCachedResults, &nbScreenedOutResults,
+      screeningDuration](unsigned int i){
+      std::string inputsHash;
+      bool screenedOut = false;
+      // a screening verdict left by a previous run is never reported with the results of this one
+      if (screeningDuration > 0.)
+        remove(computeResultFile(computeScreeningScenarioId(events[i]->getId())));
+      if (!baseInputsHash.empty()) {
+        inputsHash = computeScenarioInputsHash(baseInputsHash, events[i]);
+        if (restoreCachedResult(events[i]->getId(), inputsHash, screenedOut)) {
+          ++nbCachedResults;
+          if (screenedOut)
+            streamResult(importResult(computeScreeningScenarioId(events[i]->getId()), false));
+          streamResult(importResult(events[i]->getId(), false));
+          return;
+        }
+      }
+      SimulationResult result;
+      if (screeningDuration > 0.) {
+        result = launchScenario(events[i], screeningDuration);
+        screenedOut = result.isScreening() && result.getStatus() != CONVERGENCE_STATUS;
+        if (screenedOut) {
+          // the scenario is simulated again until the stop time of the job, the verdict of the screening being reported apart
+          ++nbScreenedOutResults;
+          result.setScenarioId(computeScreeningScenarioId(events[i]->getId()));
+          // the outputs of the screening are never reported
+          result.clearOutputs();
+          exportResult(result);
+          streamResult(result);
+          result = launchScenario(events[i]);
+        }
+      } else {
+        result = launchScenario(events[i]);
+      }
+      // the discarded outputs are never written in the result file read by the root process
+      if (!scenarios->keepsOutputs(result.getStatus()))
+        result.clearOutputs();
       exportResult(result);
+      streamResult(result);
+      if (!inputsHash.empty())
+        cacheResult(events[i]->getId(), inputsHash, screenedOut);
   });
 
   multiprocessing::Context::sync();
+  if (!baseInputsHash.empty()) {
+#ifdef _MPI_
+    std::vector<unsigned int> allNbCachedResults;
+    context.gather(nbCachedResults, allNbCachedResults);
+    if (context.isRootProc())
+      nbCachedResults = std::accumulate(allNbCachedResults.begin(), allNbCachedResults.end(), 0u);
+#endif
+    TraceInfo(logTag_) << DYNAlgorithmsLog(CachedResultsReused, nbCachedResults, events.size()) << Trace::endline;
+  }
+  if (screeningDuration > 0.) {
+#ifdef _MPI_
+    std::vector<unsigned int> allNbScreenedOutResults;
+    context.gather(nbScreenedOutResults, allNbScreenedOutResults);
+    if (context.isRootProc())
+      nbScreenedOutResults = std::accumulate(allNbScreenedOutResults.begin(), allNbScreenedOutResults.end(), 0u);
+#endif
+    TraceInfo(logTag_) << DYNAlgorithmsLog(ScreeningScenariosRerun, nbScreenedOutResults, events.size()) << Trace::endline;
+  }
 
   // Update results for root proc
   if (context.isRootProc()) {
     for (unsigned int i = 0; i < events.size(); i++) {
       const auto& scenario = events.at(i);
-      results_.at(i) = importResult(scenario->getId());
+      // the screening verdict of a scenario simulated again is reported just before its full duration result
+      if (screeningDuration > 0.) {
+        const std::string screeningId = computeScreeningScenarioId(scenario->getId());
+        const SimulationResult screeningResult = importResult(screeningId, false);
+        if (screeningResult.isScreening() && screeningResult.getStatus() != CONVERGENCE_STATUS)
+          results_.push_back(screeningResult);
+        cleanResult(screeningId);
+      }
+      results_.push_back(importResult(scenario->getId()));
       cleanResult(scenario->getId());
     }
   }
@@ -108,29 +233,41 @@ SystematicAnalysisLauncher::launch() {
 }
 
 SimulationResult
-SystematicAnalysisLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario) {
+SystematicAnalysisLauncher::launchScenario(const boost::shared_ptr<Scenario>& scenario, double screeningDuration) {
   if (multiprocessing::context().nbProcs() == 1)
     std::cout << " Launch scenario :" << scenario->getId() << " dydFile =" << scenario->getDydFile()
               << " criteriaFile =" << scenario->getCriteriaFile() << std::endl;
 
   std::string workingDir  = createAbsolutePath(scenario->getId(), workingDirectory_);
-  std::shared_ptr<job::JobEntry> job = inputs_.cloneJobEntry();
+  // the contingency models are added to the base job, their initial values being computed while the shared state is restored
+  const MultiVariantInputs& inputs = initialStateFile_.empty() ? inputs_ : initializedInputs_;
+  std::shared_ptr<job::JobEntry> job = inputs.cloneJobEntry();
 
   addDydFileToJob(job, scenario->getDydFile());
+  addEventsToJob(job, scenario, workingDir);
   setCriteriaFileForJob(job, scenario->getCriteriaFile());
 
   SimulationParameters params;
   initParametersWithJob(job, params);
+  if (!initialStateFile_.empty()) {
+    params.InitialStateFile_ = initialStateFile_;
+    params.iidmFile_ = initialIIDMFile_;
+  }
+  const double startTime = job->getSimulationEntry()->getStartTime();
+  const bool screening = screeningDuration > 0. && startTime + screeningDuration < job->getSimulationEntry()->getStopTime();
+  if (screening)
+    params.stopTime_ = startTime + screeningDuration;
 
   SimulationResult result;
   result.setScenarioId(scenario->getId());
-  boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, inputs_);
+  result.setScreening(screening);
+  boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, inputs);
 
   if (simulation) {
     simulation->setTimelineOutputFile("");
     simulation->setConstraintsOutputFile("");
     simulation->setLostEquipmentsOutputFile("");
-    simulate(simulation, result);
+    simulate(simulation, result, steadyStateDetection_ ? getLastEventTime(simulation, scenario->getId()) : -1.);
   }
 
   if (multiprocessing::context().nbProcs() == 1)
@@ -139,6 +276,193 @@ SystematicAnalysisLauncher::launchScenario(const boost::shared_ptr<Scenario>& sc
   return result;
 }
 
+void
+SystematicAnalysisLauncher::launchSharedInitialization(const std::string& baseJobsFile, Scenarios::initialization_t initialization) {
+  auto& context = multiprocessing::context();
+  const bool perProcess = initialization == Scenarios::INIT_SHARED_PER_PROCESS;
+  std::stringstream stateName;
+  stateName << "sharedInitialization";
+#ifdef _MPI_
+  if (perProcess)
+    stateName << "-" << context.rank();
+#endif
+  const std::string dumpFile = createAbsolutePath(stateName.str() + ".dmp", workingDirectory_);
+  const std::string iidmFile = createAbsolutePath(stateName.str() + ".iidm", workingDirectory_);
+  std::shared_ptr<job::JobEntry> job = inputs_.cloneJobEntry();
+  const double startTime = job->getSimulationEntry()->getStartTime();
+  bool success = false;
+  if (perProcess || context.isRootProc()) {
+    std::string workingDir = createAbsolutePath(stateName.str(), workingDirectory_);
+    if (!exists(workingDir))
+      createDirectory(workingDir);
+    // the simulation stops as soon as it is initialized
+    SimulationParameters params;
+    params.activateDumpFinalState_ = true;
+    params.activateExportIIDM_ = true;
+    params.dumpFinalStateFile_ = dumpFile;
+    params.exportIIDMFile_ = iidmFile;
+    params.stopTime_ = startTime;
+    SimulationResult result;
+    boost::shared_ptr<DYN::Simulation> simulation = createAndInitSimulation(workingDir, job, params, result, inputs_);
+    if (simulation) {
+      // only the dumped state is used
+      simulate(simulation, result, -1., false);
+      success = result.getSuccess();
+    }
+  }
+  if (perProcess) {
+    // the scenarios are only shared with the initialization if it succeeded on all the processes, for the results not to depend on the rank
+    bool allSuccess = success;
+#ifdef _MPI_
+    std::vector<bool> successes;
+    context.gather(success, successes);
+    if (context.isRootProc())
+      allSuccess = std::find(successes.begin(), successes.end(), false) == successes.end();
+#endif
+    context.broadcast(allSuccess);
+    success = allSuccess;
+  } else {
+    // the other processes wait for the root process and then read the dumped state from the working directory
+    context.broadcast(success);
+  }
+  if (!success) {
+    TraceInfo(logTag_) << DYNAlgorithmsLog(SharedInitializationFailed) << Trace::endline;
+    return;
+  }
+  initialStateFile_ = dumpFile;
+  initialIIDMFile_ = iidmFile;
+  initializedInputs_.readInputs(workingDirectory_, baseJobsFile, iidmFile);
+  TraceInfo(logTag_) << DYNAlgorithmsLog(SharedInitializationDone, startTime) << Trace::endline;
+}
+
+/**
+ * @brief Add a dyd file and the par files it refers to to a hash
+ * @param dydFile path of the dyd file
+ * @param workingDir directory the paths of the par files are relative to
+ * @param hash hash to complete
+ */
+static void
+addDydFileToHash(const std::string& dydFile, const std::string& workingDir, InputsHash& hash) {
+  hash.addFile(dydFile);
+  dynamicdata::XmlImporter importer;
+  const auto dynamicModels = importer.importFromDydFiles(std::vector<std::string>(1, dydFile));
+  std::set<std::string> parFiles;
+  for (const auto& model : dynamicModels->getModels()) {
+    const auto blackBoxModel = std::dynamic_pointer_cast<dynamicdata::BlackBoxModel>(model.second);
+    const auto modelTemplateExpansion = std::dynamic_pointer_cast<dynamicdata::ModelTemplateExpansion>(model.second);
+    const auto modelicaModel = std::dynamic_pointer_cast<dynamicdata::ModelicaModel>(model.second);
+    if (blackBoxModel) {
+      parFiles.insert(blackBoxModel->getParFile());
+    } else if (modelTemplateExpansion) {
+      parFiles.insert(modelTemplateExpansion->getParFile());
+    } else if (modelicaModel) {
+      for (const auto& unitDynamicModel : modelicaModel->getUnitDynamicModels())
+        parFiles.insert(unitDynamicModel.second->getParFile());
+    }
+  }
+  parFiles.erase("");
+  for (const auto& parFile : parFiles)
+    hash.addFile(createAbsolutePath(parFile, workingDir));
+}
+
+std::string
+SystematicAnalysisLauncher::computeBaseInputsHash(const std::string& baseJobsFile, const boost::shared_ptr<Scenarios>& scenarios) const {
+  InputsHash hash;
+  hash.addFile(createAbsolutePath(baseJobsFile, workingDirectory_));
+  hash.addFile(inputs_.iidmPath().generic_string());
+  std::shared_ptr<job::JobEntry> job = inputs_.cloneJobEntry();
+  const std::shared_ptr<job::ModelerEntry>& modeler = job->getModelerEntry();
+  for (const auto& dynModels : modeler->getDynModelsEntries())
+    addDydFileToHash(createAbsolutePath(dynModels->getDydFile(), workingDirectory_), workingDirectory_, hash);
+  if (modeler->getNetworkEntry())
+    hash.addFile(createAbsolutePath(modeler->getNetworkEntry()->getNetworkParFile(), workingDirectory_));
+  if (modeler->getInitialStateEntry())
+    hash.addFile(createAbsolutePath(modeler->getInitialStateEntry()->getInitialStateFile(), workingDirectory_));
+  hash.addFile(createAbsolutePath(job->getSolverEntry()->getParametersFile(), workingDirectory_));
+  for (const auto& criteriaFile : job->getSimulationEntry()->getCriteriaFiles())
+    hash.addFile(createAbsolutePath(criteriaFile, workingDirectory_));
+
+  std::stringstream settings;
+  settings << std::setprecision(15) << static_cast<int>(scenarios->getInitialization()) << " " << scenarios->getScreeningDuration()
+           << " " << static_cast<int>(scenarios->getOutputsRetention());
+  if (steadyStateDetection_) {
+    settings << " " << steadyStateDetection_->getWindow() << " " << steadyStateDetection_->getThreshold();
+    for (const auto& variable : steadyStateDetection_->getVariables())
+      settings << " " << variable.first << " " << variable.second;
+  }
+  hash.addString(settings.str());
+  return hash.str();
+}
+
+std::string
+SystematicAnalysisLauncher::computeScenarioInputsHash(const std::string& baseInputsHash, const boost::shared_ptr<Scenario>& scenario) const {
+  InputsHash hash;
+  hash.addString(baseInputsHash);
+  if (!scenario->getDydFile().empty())
+    addDydFileToHash(createAbsolutePath(scenario->getDydFile(), workingDirectory_), workingDirectory_, hash);
+  else
+    hash.addString("");
+  hash.addString(scenario->getCriteriaFile());
+  if (!scenario->getCriteriaFile().empty())
+    hash.addFile(createAbsolutePath(scenario->getCriteriaFile(), workingDirectory_));
+  for (const auto& event : scenario->getEvents()) {
+    std::stringstream description;
+    description << std::setprecision(15) << event.elementId_ << " " << static_cast<int>(event.type_) << " " << event.time_
+                << " " << event.modelId_ << " " << event.variable_;
+    for (const auto& parameter : event.parameters_)
+      description << " " << parameter.name_ << " " << parameter.type_ << " " << parameter.value_;
+    hash.addString(description.str());
+  }
+  return hash.str();
+}
+
+bool
+SystematicAnalysisLauncher::restoreCachedResult(const std::string& id, const std::string& inputsHash, bool& screenedOut) const {
+  const std::string cachedResultFile = createAbsolutePath(id + ".save.txt", resultsCacheDirectory_);
+  const std::string screeningId = computeScreeningScenarioId(id);
+  const std::string cachedScreeningResultFile = createAbsolutePath(screeningId + ".save.txt", resultsCacheDirectory_);
+  std::ifstream hashFile(createAbsolutePath(id + ".hash", resultsCacheDirectory_).c_str());
+  std::string cachedHash;
+  screenedOut = false;
+  if (!(hashFile >> cachedHash) || cachedHash != inputsHash || !exists(cachedResultFile))
+    return false;
+  boost::filesystem::copy_file(cachedResultFile, computeResultFile(id), boost::filesystem::copy_option::overwrite_if_exists);
+  screenedOut = exists(cachedScreeningResultFile);
+  if (screenedOut)
+    boost::filesystem::copy_file(cachedScreeningResultFile, computeResultFile(screeningId), boost::filesystem::copy_option::overwrite_if_exists);
+  return true;
+}
+
+void
+SystematicAnalysisLauncher::cacheResult(const std::string& id, const std::string& inputsHash, bool screenedOut) const {
+  if (!exists(resultsCacheDirectory_))
+    createDirectory(resultsCacheDirectory_);
+  // the hash is written last, for an interrupted copy of the result not to be reused
+  const std::string hashFile = createAbsolutePath(id + ".hash", resultsCacheDirectory_);
+  remove(hashFile);
+  boost::filesystem::copy_file(computeResultFile(id), createAbsolutePath(id + ".save.txt", resultsCacheDirectory_),
+      boost::filesystem::copy_option::overwrite_if_exists);
+  const std::string screeningId = computeScreeningScenarioId(id);
+  const std::string cachedScreeningResultFile = createAbsolutePath(screeningId + ".save.txt", resultsCacheDirectory_);
+  if (screenedOut)
+    boost::filesystem::copy_file(computeResultFile(screeningId), cachedScreeningResultFile, boost::filesystem::copy_option::overwrite_if_exists);
+  else
+    remove(cachedScreeningResultFile);
+  std::ofstream file(hashFile.c_str());
+  file << inputsHash << std::endl;
+}
+
+void
+SystematicAnalysisLauncher::streamResult(const SimulationResult& result) const {
+  // the file is opened for each result, so that every result is written on the disk as soon as it is known
+  std::ofstream file(partialResultsFile_.c_str(), std::ios::binary | std::ios::app);
+  if (!file.is_open())
+    throw DYNAlgorithmsError(FileGenerationFailed, partialResultsFile_);
+  aggregatedResults::XmlExporter exporter;
+  exporter.exportScenarioResultToStream(result, file);
+  file << std::endl;
+}
+
 void
 SystematicAnalysisLauncher::createOutputs(std::map<std::string, std::string>& mapData, bool zipIt) const {
   aggregatedResults::XmlExporter exporter;
@@ -157,6 +481,13 @@ SystematicAnalysisLauncher::createOutputs(std::map<std::string, std::string>& ma
       writeOutputs(results_[i]);
     }
   }
+
+  // the aggregated results file is complete
+  for (unsigned int rank = 0; rank < multiprocessing::context().nbProcs(); ++rank) {
+    const std::string partialResultsFile = computePartialResultsFile(outputFileFullPath_, rank);
+    if (exists(partialResultsFile))
+      remove(partialResultsFile);
+  }
 }
 
 }  // namespace DYNAlgorithms
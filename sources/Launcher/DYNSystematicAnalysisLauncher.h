@@ -21,6 +21,7 @@
 #define LAUNCHER_DYNSYSTEMATICANALYSISLAUNCHER_H_
 
 #include "DYNRobustnessAnalysisLauncher.h"
+#include "DYNScenarios.h"
 
 #include <boost/shared_ptr.hpp>
 #include <map>
@@ -42,7 +43,7 @@ class SystematicAnalysisLauncher : public RobustnessAnalysisLauncher {
    */
   void launch();
 
- private:
+ protected:
   /**
    * @brief create outputs file for each job
    * @param mapData map associating a fileName and the data contained in the file
@@ -53,12 +54,81 @@ class SystematicAnalysisLauncher : public RobustnessAnalysisLauncher {
   /**
    * launch the calculation of one scenario
    * @param scenario scenario to launch
+   * @param screeningDuration duration of the simulation of the scenario for the screening, 0 to simulate it until the stop time of the job
    * @return result of the scenario
    */
-  SimulationResult launchScenario(const boost::shared_ptr<Scenario>& scenario);
+  SimulationResult launchScenario(const boost::shared_ptr<Scenario>& scenario, double screeningDuration = 0.);
+
+  /**
+   * @brief Initialize the base situation once and dump its initial state to start all the scenarios from it
+   *
+   * With a shared initialization, the simulation is done by the root process and the other processes read the dumped state
+   * from the working directory. With a shared initialization per process, each process initializes its own copy.
+   *
+   * @param baseJobsFile jobs file of the base situation
+   * @param initialization initialization of the scenarios simulations
+   */
+  void launchSharedInitialization(const std::string& baseJobsFile, Scenarios::initialization_t initialization);
+
+  /**
+   * @brief Compute the hash of the inputs common to all the scenarios
+   *
+   * The inputs are the base jobs file and the files it refers to (dyd and par files, network, solver parameters, criteria and initial state),
+   * and the settings of the analysis changing the results of the scenarios
+   *
+   * @param baseJobsFile jobs file of the base situation
+   * @param scenarios scenarios of the analysis
+   * @return hash of the common inputs
+   */
+  std::string computeBaseInputsHash(const std::string& baseJobsFile, const boost::shared_ptr<Scenarios>& scenarios) const;
+
+  /**
+   * @brief Compute the hash of all the inputs of a scenario
+   * @param baseInputsHash hash of the inputs common to all the scenarios
+   * @param scenario scenario
+   * @return hash of the inputs of the scenario: the common ones, its dyd file and the par files it refers to, its criteria file and its events
+   */
+  std::string computeScenarioInputsHash(const std::string& baseInputsHash, const boost::shared_ptr<Scenario>& scenario) const;
+
+  /**
+   * @brief Restore the result of a scenario from the results cache if its inputs did not change
+   *
+   * The screening result of the scenario is restored with it if the scenario was simulated again after its screening
+   *
+   * @param id id of the scenario
+   * @param inputsHash hash of the inputs of the scenario
+   * @param screenedOut set to true if a screening result was restored, to false otherwise
+   * @return true if the cached result was restored as the result of the scenario, false if the scenario has to be simulated
+   */
+  bool restoreCachedResult(const std::string& id, const std::string& inputsHash, bool& screenedOut) const;
+
+  /**
+   * @brief Keep the result of a scenario in the results cache
+   * @param id id of the scenario
+   * @param inputsHash hash of the inputs of the scenario
+   * @param screenedOut true if the scenario was simulated again after its screening, its screening result being cached too
+   */
+  void cacheResult(const std::string& id, const std::string& inputsHash, bool screenedOut) const;
+
+  /**
+   * @brief Append the result of a scenario to the partial results file of the process, as soon as it is known
+   *
+   * The partial results files only show the progress of the analysis: they are removed once the aggregated results file is written,
+   * this file being still built at the end from the results of all the scenarios gathered by the root process
+   *
+   * @param result result of the scenario
+   */
+  void streamResult(const SimulationResult& result) const;
+
+ protected:
+  std::string resultsCacheDirectory_;  ///< directory of the results cache, empty if the results are not cached
 
  private:
   std::vector<SimulationResult> results_;  ///< results of the systematic analysis
+  std::string initialStateFile_;  ///< initial state shared by the scenarios, empty if each scenario computes its own
+  std::string initialIIDMFile_;  ///< network of the initial state shared by the scenarios
+  MultiVariantInputs initializedInputs_;  ///< inputs of the scenarios starting from the shared initial state
+  std::string partialResultsFile_;  ///< file the results of the scenarios simulated by the process are appended to
 };
 }  // namespace DYNAlgorithms
 
@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest_dynawo.h>
+
+#include "DYNCriticalTimeLauncher.h"
+#include "DYNResultCommon.h"
+#include "DYNSimulationResult.h"
+
+testing::Environment* initXmlEnvironment();
+
+namespace DYNAlgorithms {
+testing::Environment* const env = initXmlEnvironment();
+
+class MyCriticalTimeLauncher : public CriticalTimeLauncher {
+ public:
+  void testFaultOnCheckpoints() {
+    // the clearing times of the first three levels of the dichotomy
+    std::vector<double> checkpoints = computeFaultOnCheckpoints(0., 0.8, 0.1);
+    ASSERT_EQ(checkpoints.size(), 7);
+    for (unsigned int i = 0; i < checkpoints.size(); ++i)
+      ASSERT_DOUBLE_EQ(checkpoints[i], 0.1 * (i + 1));
+
+    checkpoints = computeFaultOnCheckpoints(1., 2., 0.01);
+    ASSERT_EQ(checkpoints.size(), 7);
+    ASSERT_DOUBLE_EQ(checkpoints.front(), 1.12);
+    ASSERT_DOUBLE_EQ(checkpoints[3], 1.5);
+    ASSERT_DOUBLE_EQ(checkpoints.back(), 1.87);
+
+    // the checkpoints rounded to the same value or to a bound of the research are dropped
+    checkpoints = computeFaultOnCheckpoints(0., 1., 0.5);
+    ASSERT_EQ(checkpoints.size(), 1);
+    ASSERT_DOUBLE_EQ(checkpoints.front(), 0.5);
+    ASSERT_TRUE(computeFaultOnCheckpoints(0., 0.01, 0.01).empty());
+
+    // two close checkpoints never share the same state files
+    ASSERT_EQ(computeFaultOnStateName(0.1), "faultOnState-0.100000000000000");
+    ASSERT_NE(computeFaultOnStateName(0.1), computeFaultOnStateName(0.1000001));
+  }
+
+  void testInterpolatedCriticalTime() {
+    SimulationResult result;
+    ASSERT_DOUBLE_EQ(computeFailureIndicator(result, 1.), -1.);
+    std::vector<std::pair<double, std::string> > failingCriteria;
+    failingCriteria.push_back(std::make_pair(3., "MyCriteria"));
+    failingCriteria.push_back(std::make_pair(1.5, "MyOtherCriteria"));
+    result.setFailingCriteria(failingCriteria);
+    result.setStatus(CRITERIA_NON_RESPECTED_STATUS);
+    // the earliest failing criteria is used
+    ASSERT_DOUBLE_EQ(computeFailureIndicator(result, 1.), 2.);
+    // a failure before the clearing of the fault is not informative
+    ASSERT_DOUBLE_EQ(computeFailureIndicator(result, 1.5), -1.);
+    // the criteria of a previous iteration are ignored when the next one fails for another reason
+    result.setStatus(EXECUTION_PROBLEM_STATUS);
+    ASSERT_DOUBLE_EQ(computeFailureIndicator(result, 1.2), -1.);
+    result.setStatus(DIVERGENCE_STATUS);
+    ASSERT_DOUBLE_EQ(computeFailureIndicator(result, 1.2), -1.);
+
+    std::map<double, double> failureIndicators;
+    ASSERT_DOUBLE_EQ(interpolateCriticalTime(failureIndicators, 0.5, 1., 0.01), -1.);
+    failureIndicators[1.] = 2.;
+    ASSERT_DOUBLE_EQ(interpolateCriticalTime(failureIndicators, 0.5, 1., 0.01), -1.);
+    // the indicators of the two lowest failed clearing times vanish at 0.8
+    failureIndicators[1.2] = 4.;
+    failureIndicators[1.5] = 5.;
+    ASSERT_DOUBLE_EQ(interpolateCriticalTime(failureIndicators, 0.5, 1., 0.01), 0.8);
+    // the interpolated time must be strictly inside the range
+    ASSERT_DOUBLE_EQ(interpolateCriticalTime(failureIndicators, 0.8, 1., 0.01), -1.);
+    ASSERT_DOUBLE_EQ(interpolateCriticalTime(failureIndicators, 0.5, 0.8, 0.01), -1.);
+    // indicators not decreasing towards the critical time are uninformative
+    failureIndicators[1.2] = 1.;
+    ASSERT_DOUBLE_EQ(interpolateCriticalTime(failureIndicators, 0.5, 1., 0.01), -1.);
+  }
+
+  void testTimeAfterDivergence() {
+    double tLowestFailed = 1.;
+    double divergenceStep = 0.;
+    // a first solver issue is followed by a time one accuracy below it
+    double tMax = computeTimeAfterDivergence(1., 0., tLowestFailed, divergenceStep, 0.01);
+    ASSERT_DOUBLE_EQ(tMax, 0.99);
+    ASSERT_DOUBLE_EQ(tLowestFailed, 1.);
+    ASSERT_DOUBLE_EQ(divergenceStep, 0.01);
+    // each solver issue confirmed at the step doubles it
+    const double expectedTimes[] = {0.97, 0.93, 0.85, 0.69, 0.37};
+    for (double expectedTime : expectedTimes) {
+      const double tFailed = tMax;
+      tMax = computeTimeAfterDivergence(tMax, 0., tLowestFailed, divergenceStep, 0.01);
+      ASSERT_DOUBLE_EQ(tLowestFailed, tFailed);
+      ASSERT_DOUBLE_EQ(tMax, expectedTime);
+    }
+    // the step never goes below the middle of the range
+    tMax = computeTimeAfterDivergence(tMax, 0., tLowestFailed, divergenceStep, 0.01);
+    ASSERT_DOUBLE_EQ(tLowestFailed, 0.37);
+    ASSERT_DOUBLE_EQ(tMax, 0.185);
+    ASSERT_DOUBLE_EQ(divergenceStep, 0.185);
+
+    // a solver issue at another time than the step starts again from the accuracy
+    tLowestFailed = 0.97;
+    divergenceStep = 0.04;
+    tMax = computeTimeAfterDivergence(0.5, 0., tLowestFailed, divergenceStep, 0.01);
+    ASSERT_DOUBLE_EQ(tMax, 0.96);
+    ASSERT_DOUBLE_EQ(tLowestFailed, 0.97);
+    ASSERT_DOUBLE_EQ(divergenceStep, 0.01);
+  }
+};
+
+TEST(TestCriticalTimeLauncher, TestFaultOnCheckpoints) {
+  MyCriticalTimeLauncher launcher;
+  launcher.testFaultOnCheckpoints();
+}
+
+TEST(TestCriticalTimeLauncher, TestInterpolatedCriticalTime) {
+  MyCriticalTimeLauncher launcher;
+  launcher.testInterpolatedCriticalTime();
+}
+
+TEST(TestCriticalTimeLauncher, TestTimeAfterDivergence) {
+  MyCriticalTimeLauncher launcher;
+  launcher.testTimeAfterDivergence();
+}
+
+}  // namespace DYNAlgorithms
@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+#include <gtest_dynawo.h>
+
+#include "DYNMarginCalculationLauncher.h"
+#include "DYNLoadIncreaseResult.h"
+#include "DYNResultCommon.h"
+#include "DYNSimulationResult.h"
+
+testing::Environment* initXmlEnvironment();
+
+namespace DYNAlgorithms {
+testing::Environment* const env = initXmlEnvironment();
+
+class MyMarginCalculationLauncher : public MarginCalculationLauncher {
+ public:
+  void testScenarioBounds() {
+    resetResearch(2);
+    ASSERT_FALSE(isScenarioDecided(0, 0.));
+    ASSERT_FALSE(isScenarioDecided(0, 100.));
+    ASSERT_FALSE(isScenarioKnownToFail(0, 100.));
+
+    updateScenarioBounds(0, 50., CONVERGENCE_STATUS, -1.);
+    updateScenarioBounds(0, 75., CRITERIA_NON_RESPECTED_STATUS, 0.4);
+    // a scenario passing for a variation passes below it, a scenario failing for a variation fails above it
+    ASSERT_TRUE(isScenarioDecided(0, 25.));
+    ASSERT_TRUE(isScenarioDecided(0, 50.));
+    ASSERT_FALSE(isScenarioDecided(0, 60.));
+    ASSERT_TRUE(isScenarioDecided(0, 75.));
+    ASSERT_TRUE(isScenarioDecided(0, 100.));
+    ASSERT_FALSE(isScenarioKnownToFail(0, 50.));
+    ASSERT_FALSE(isScenarioKnownToFail(0, 60.));
+    ASSERT_TRUE(isScenarioKnownToFail(0, 75.));
+    ASSERT_TRUE(isScenarioKnownToFail(0, 100.));
+    // the bounds of a scenario are independent from the other ones
+    ASSERT_FALSE(isScenarioDecided(1, 25.));
+    ASSERT_FALSE(isScenarioDecided(1, 100.));
+
+    // the results contradicting the known bounds are ignored
+    updateScenarioBounds(0, 25., DIVERGENCE_STATUS, -1.);
+    updateScenarioBounds(0, 100., CONVERGENCE_STATUS, -1.);
+    ASSERT_FALSE(isScenarioKnownToFail(0, 25.));
+    ASSERT_TRUE(isScenarioKnownToFail(0, 100.));
+    updateScenarioBounds(0, 60., DIVERGENCE_STATUS, -1.);
+    ASSERT_TRUE(isScenarioKnownToFail(0, 60.));
+    ASSERT_TRUE(isScenarioDecided(0, 70.));
+
+    SimulationResult passed;
+    fillDecidedScenarioResult(0, "MyScenario", 40., passed);
+    ASSERT_EQ(passed.getScenarioId(), "MyScenario");
+    ASSERT_DOUBLE_EQ(passed.getVariation(), 40.);
+    ASSERT_TRUE(passed.getSuccess());
+    ASSERT_EQ(passed.getStatus(), CONVERGENCE_STATUS);
+    SimulationResult failed;
+    fillDecidedScenarioResult(0, "MyScenario", 80., failed);
+    ASSERT_EQ(failed.getScenarioId(), "MyScenario");
+    ASSERT_DOUBLE_EQ(failed.getVariation(), 80.);
+    ASSERT_FALSE(failed.getSuccess());
+    // the status of the lowest known failure is reported
+    ASSERT_EQ(failed.getStatus(), DIVERGENCE_STATUS);
+
+    // nothing is known anymore for a new research
+    resetResearch(1);
+    ASSERT_FALSE(isScenarioDecided(0, 100.));
+  }
+
+  void testSelectTaskVariation() {
+    resetResearch(3);
+    // the failure ratios are known at the upper bound of the bracket: late failure for the first scenario, early one for the second
+    updateScenarioBounds(0, 100., CRITERIA_NON_RESPECTED_STATUS, 1.);
+    updateScenarioBounds(1, 100., CRITERIA_NON_RESPECTED_STATUS, 0.);
+    updateScenarioBounds(2, 100., DIVERGENCE_STATUS, -1.);
+    ASSERT_DOUBLE_EQ(selectTaskVariation(task_t(50., 100.)), 75.);
+    ASSERT_DOUBLE_EQ(selectTaskVariation(task_t(50., 100., std::vector<size_t>(1, 0))), 85.);
+    ASSERT_DOUBLE_EQ(selectTaskVariation(task_t(50., 100., std::vector<size_t>(1, 1))), 65.);
+    // without a known failure ratio, the margin is uniformly distributed over the bracket
+    ASSERT_DOUBLE_EQ(selectTaskVariation(task_t(50., 100., std::vector<size_t>(1, 2))), 75.);
+    std::vector<size_t> ids;
+    ids.push_back(0);
+    ids.push_back(1);
+    ASSERT_DOUBLE_EQ(selectTaskVariation(task_t(50., 100., ids)), 75.);
+    // the failure ratios are only used when the failure is at the upper bound of the bracket
+    ASSERT_DOUBLE_EQ(selectTaskVariation(task_t(50., 90., std::vector<size_t>(1, 0))), 70.);
+    // the selected variation always lies strictly inside the bracket
+    ASSERT_DOUBLE_EQ(selectTaskVariation(task_t(98., 100., std::vector<size_t>(1, 0))), 99.);
+  }
+
+  void testSequentialOutputs() {
+    resetResearch(1);
+    results_.clear();
+    // the load increase fails at 100%
+    addLoadLevel(100., false);
+    dropSupersededOutputs();
+    ASSERT_FALSE(results_[0].getResult().getTimelineStreamStr().empty());
+
+    // the load increase passes at 50%: its outputs are kept while its scenario is not launched
+    addLoadLevel(50., true);
+    dropSupersededOutputs();
+    ASSERT_FALSE(results_[1].getResult().getTimelineStreamStr().empty());
+    ASSERT_FALSE(results_[1].getResult().getOutputIIDMStreamStr().empty());
+
+    // the scenario passes at 50%: this level is the best one of the load increase
+    setScenarioResult(results_[1], "MyScenario", 50., true);
+    dropSupersededOutputs();
+    ASSERT_FALSE(results_[0].getResult().getTimelineStreamStr().empty());
+    ASSERT_FALSE(results_[1].getResult().getTimelineStreamStr().empty());
+    ASSERT_FALSE(results_[1].getResult().getOutputIIDMStreamStr().empty());
+    ASSERT_FALSE(results_[1].getScenarioResult(0).getTimelineStreamStr().empty());
+
+    // the scenario fails at 75%: this level becomes the worst one, the load increase failing at 100% is superseded
+    addLoadLevel(75., true);
+    dropSupersededOutputs();
+    ASSERT_FALSE(results_[0].getResult().getTimelineStreamStr().empty());
+    setScenarioResult(results_[2], "MyScenario", 75., false);
+    dropSupersededOutputs();
+    ASSERT_TRUE(results_[0].getResult().getTimelineStreamStr().empty());
+    ASSERT_FALSE(results_[1].getResult().getTimelineStreamStr().empty());
+    ASSERT_FALSE(results_[1].getScenarioResult(0).getTimelineStreamStr().empty());
+    ASSERT_FALSE(results_[2].getResult().getTimelineStreamStr().empty());
+    ASSERT_FALSE(results_[2].getScenarioResult(0).getTimelineStreamStr().empty());
+  }
+
+ private:
+  void addLoadLevel(double variation, bool success) {
+    results_.emplace_back(1);
+    SimulationResult& result = results_.back().getResult();
+    result.setScenarioId("loadIncrease");
+    result.setVariation(variation);
+    result.setSuccess(success);
+    result.setStatus(success ? CONVERGENCE_STATUS : DIVERGENCE_STATUS);
+    result.getTimelineStream() << "MyLoadIncreaseTimeline";
+    result.getOutputIIDMStream() << "MyLoadIncreaseFinalState";
+  }
+
+  void setScenarioResult(LoadIncreaseResult& loadIncreaseResult, const std::string& scenarioId, double variation, bool success) {
+    SimulationResult& result = loadIncreaseResult.getScenarioResult(0);
+    result.setScenarioId(scenarioId);
+    result.setVariation(variation);
+    result.setSuccess(success);
+    result.setStatus(success ? CONVERGENCE_STATUS : CRITERIA_NON_RESPECTED_STATUS);
+    result.getTimelineStream() << "MyScenarioTimeline";
+  }
+};
+
+TEST(TestMarginCalculationLauncher, TestScenarioBounds) {
+  MyMarginCalculationLauncher launcher;
+  launcher.testScenarioBounds();
+}
+
+TEST(TestMarginCalculationLauncher, TestSelectTaskVariation) {
+  MyMarginCalculationLauncher launcher;
+  launcher.testSelectTaskVariation();
+}
+
+TEST(TestMarginCalculationLauncher, TestSequentialOutputs) {
+  MyMarginCalculationLauncher launcher;
+  launcher.testSequentialOutputs();
+}
+
+}  // namespace DYNAlgorithms
@@ -11,6 +11,9 @@
 // of simulation tools for power systems.
 //
 
+#include <fstream>
+#include <sstream>
+
 #include <DYNFileSystemUtils.h>
 #include <JOBXmlImporter.h>
 #include <JOBJobsCollection.h>
@@ -23,6 +26,7 @@
 #include <libzip/ZipFile.h>
 #include <libzip/ZipFileFactory.h>
 #include <libzip/ZipOutputStream.h>
+#include <xml/sax/parser/ParserException.h>
 
 #include "DYNRobustnessAnalysisLauncher.h"
 #include "DYNResultCommon.h"
@@ -121,6 +125,16 @@ class MyLauncher : public RobustnessAnalysisLauncher {
     ASSERT_EQ(mc->getScenarios()->getJobsFile(), "myScenarios.jobs");
   }
 
+  void testParseInputData() {
+    std::ifstream file("res/fic_MULTIPLE.xml", std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    multipleJobs_.reset();
+    multipleJobs_ = parseInputData(content.str(), false);
+    testMultipleJobs();
+    ASSERT_THROW(parseInputData("<?xml version=\"1.0\" encoding=\"UTF-8\"?><multipleJobs", false), xml::sax::parser::ParserException);
+  }
+
  protected:
   void createOutputs(std::map<std::string, std::string>& mapData, bool) const {
     storeOutputs(result_, mapData);
@@ -166,6 +180,9 @@ TEST(TestLauncher, TestRobustnessAnalysisLauncher) {
   launcher.setInputFile("res/MyInputFile.txt");
   ASSERT_THROW_DYNAWO(launcher.init(), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::InputFileFormatNotSupported);
 
+  launcher.setInputFile("res/MyInvalidInputFile.xml");
+  ASSERT_THROW_DYNAWO(launcher.init(), DYN::Error::GENERAL, DYNAlgorithms::KeyAlgorithmsError_t::XmlParsingError);
+
   boost::shared_ptr<zip::ZipFile> archive = zip::ZipFileFactory::newInstance();
   boost::shared_ptr<zip::ZipEntry> entry(new zip::ZipEntry("res/fic_MULTIPLE.xml"));
   archive->addEntry("fic_MULTIPLE.xml", entry->getData());
@@ -176,6 +193,7 @@ TEST(TestLauncher, TestRobustnessAnalysisLauncher) {
   ASSERT_NO_THROW(launcher.init());
   launcher.testOutputFileFullPath(createAbsolutePath("MyOutputFile.zip", createAbsolutePath("res", currentPath())));
   launcher.testMultipleJobs();
+  launcher.testParseInputData();
   launcher.launch();
 }
 
@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2015-2021, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+// This file is part of Dynawo, an hybrid C++/Modelica open source suite
+// of simulation tools for power systems.
+//
+
+#include <string>
+
+#include <DYNFileSystemUtils.h>
+
+#include <gtest_dynawo.h>
+#include <boost/make_shared.hpp>
+
+#include "DYNSystematicAnalysisLauncher.h"
+#include "DYNResultCommon.h"
+#include "DYNScenario.h"
+#include "DYNSimulationResult.h"
+
+testing::Environment* initXmlEnvironment();
+
+namespace DYNAlgorithms {
+testing::Environment* const env = initXmlEnvironment();
+
+class MySystematicAnalysisLauncher : public SystematicAnalysisLauncher {
+ public:
+  void testResultsCache() {
+    workingDirectory_ = createAbsolutePath("res", currentPath());
+    resultsCacheDirectory_ = createAbsolutePath("resultsCache", workingDirectory_);
+    boost::shared_ptr<Scenario> scenario = boost::make_shared<Scenario>();
+    scenario->setId("MyCachedScenario");
+    scenario->setCriteriaFile("MyCrtFile.crt");
+    Scenario::Event event;
+    event.elementId_ = "MyLine";
+    event.time_ = 1.;
+    scenario->addEvent(event);
+    const std::string inputsHash = computeScenarioInputsHash("MyBaseHash", scenario);
+    ASSERT_EQ(computeScenarioInputsHash("MyBaseHash", scenario), inputsHash);
+
+    // nothing is cached yet
+    bool screenedOut = true;
+    ASSERT_FALSE(restoreCachedResult(scenario->getId(), inputsHash, screenedOut));
+    ASSERT_FALSE(screenedOut);
+
+    SimulationResult result;
+    result.setScenarioId(scenario->getId());
+    result.setSuccess(true);
+    result.setStatus(CONVERGENCE_STATUS);
+    exportResult(result);
+    cacheResult(scenario->getId(), inputsHash, false);
+    cleanResult(scenario->getId());
+    ASSERT_TRUE(restoreCachedResult(scenario->getId(), inputsHash, screenedOut));
+    ASSERT_FALSE(screenedOut);
+    SimulationResult restoredResult = importResult(scenario->getId(), false);
+    ASSERT_EQ(restoredResult.getScenarioId(), "MyCachedScenario");
+    ASSERT_TRUE(restoredResult.getSuccess());
+    ASSERT_EQ(restoredResult.getStatus(), CONVERGENCE_STATUS);
+
+    // the cached result is not reused when the inputs change
+    ASSERT_NE(computeScenarioInputsHash("MyOtherBaseHash", scenario), inputsHash);
+    boost::shared_ptr<Scenario> changedScenario = boost::make_shared<Scenario>();
+    changedScenario->setId("MyCachedScenario");
+    changedScenario->setCriteriaFile("MyCrtFile.crt");
+    event.time_ = 2.;
+    changedScenario->addEvent(event);
+    const std::string changedInputsHash = computeScenarioInputsHash("MyBaseHash", changedScenario);
+    ASSERT_NE(changedInputsHash, inputsHash);
+    ASSERT_FALSE(restoreCachedResult(scenario->getId(), changedInputsHash, screenedOut));
+
+    // the screening result of a scenario simulated again is cached with it
+    SimulationResult screeningResult;
+    screeningResult.setScenarioId("MyCachedScenario_screening");
+    screeningResult.setScreening(true);
+    screeningResult.setStatus(CRITERIA_NON_RESPECTED_STATUS);
+    exportResult(screeningResult);
+    cacheResult(scenario->getId(), inputsHash, true);
+    cleanResult("MyCachedScenario_screening");
+    ASSERT_TRUE(restoreCachedResult(scenario->getId(), inputsHash, screenedOut));
+    ASSERT_TRUE(screenedOut);
+    SimulationResult restoredScreeningResult = importResult("MyCachedScenario_screening", false);
+    ASSERT_TRUE(restoredScreeningResult.isScreening());
+    ASSERT_EQ(restoredScreeningResult.getStatus(), CRITERIA_NON_RESPECTED_STATUS);
+    cacheResult(scenario->getId(), inputsHash, false);
+    ASSERT_TRUE(restoreCachedResult(scenario->getId(), inputsHash, screenedOut));
+    ASSERT_FALSE(screenedOut);
+
+    cleanResult("MyCachedScenario_screening");
+    cleanResult(scenario->getId());
+    removeDir(resultsCacheDirectory_);
+  }
+};
+
+TEST(TestSystematicAnalysisLauncher, TestResultsCache) {
+  MySystematicAnalysisLauncher launcher;
+  launcher.testResultsCache();
+}
+
+}  // namespace DYNAlgorithms